@@ -0,0 +1,82 @@
+/**
+ * @file      board.c
+ *
+ * @author    Zéro Cool
+ * @date      19/10/2026 09:41:01
+ * @brief     Carte simulée du benchmark LCD : ATmega328P et afficheur HD44780
+ *
+ * @details   Programme hôte chargeant le firmware main.c dans simavr et reliant ses broches au
+ *            modèle d'afficheur HD44780 fourni avec simavr (examples/parts/hd44780.c), qui
+ *            simule le busy flag et la durée d'exécution des instructions :
+ *            - DB4..DB7 sur PD4..PD7 (dans les deux sens, pour la lecture du busy flag) ;
+ *            - EN, R/W et RS sur PC0, PC1 et PC2.
+ *
+ *            Le firmware écrit ses mesures sur la console simavr. La simulation se termine
+ *            lorsque le firmware s'endort avec les interruptions désactivées.
+ *
+ *            Utilisation : board firmware.elf
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sim_avr.h>
+#include <sim_elf.h>
+#include <avr_ioport.h>
+
+#include "hd44780.h"
+
+int main(int argc, char * argv[])
+{
+  elf_firmware_t firmware = { { 0 } };
+  hd44780_t lcd;
+  avr_t * avr;
+  int state;
+
+  if (argc != 2)
+  {
+    fprintf(stderr, "Utilisation : %s firmware.elf\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (elf_read_firmware(argv[1], &firmware) != 0)
+  {
+    fprintf(stderr, "%s : firmware illisible\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  avr = avr_make_mcu_by_name(firmware.mmcu);
+  if (!avr)
+  {
+    fprintf(stderr, "%s : MCU '%s' inconnu\n", argv[1], firmware.mmcu);
+    return EXIT_FAILURE;
+  }
+  avr_init(avr);
+  avr_load_firmware(avr, &firmware);
+
+  hd44780_init(avr, &lcd, 16, 2);
+
+  for (int i = 0; i < 4; i++)
+  {
+    avr_irq_t * pin  = avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('D'), 4 + i);
+    avr_irq_t * data = lcd.irq + IRQ_HD44780_D4 + i;
+
+    // AVR -> LCD
+    avr_connect_irq(pin, data);
+    // LCD -> AVR (lecture du busy flag)
+    avr_connect_irq(data, pin);
+  }
+  avr_connect_irq(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('C'), 0), lcd.irq + IRQ_HD44780_E);
+  avr_connect_irq(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('C'), 1), lcd.irq + IRQ_HD44780_RW);
+  avr_connect_irq(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('C'), 2), lcd.irq + IRQ_HD44780_RS);
+
+  do
+  {
+    state = avr_run(avr);
+  }
+  while (state != cpu_Done && state != cpu_Crashed);
+
+  avr_terminate(avr);
+
+  return state == cpu_Done ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,293 @@
+/**
+ * @file      main.c
+ *
+ * @author    Zéro Cool
+ * @date      19/10/2026 09:41:01
+ * @brief     Benchmark du rafraîchissement de l'afficheur LCD 162c
+ *
+ * @details   Firmware de mesure des performances de LCD/Displaytech/162c.h, destiné à être
+ *            exécuté par board.c (simavr et modèle HD44780, ATmega328P). Pour chaque opération,
+ *            deux durées sont mesurées avec le timer 1 (sans préscaler) puis écrites sur la
+ *            console simavr (registre GPIOR0) :
+ *            - wall : de l'appel jusqu'à ce que l'afficheur ait exécuté la dernière instruction
+ *              (file d'attente vide en mode LCD_ASYNC) ;
+ *            - cpu  : temps pendant lequel le CPU n'est pas disponible pour l'application. En
+ *              mode synchrone, il est égal à wall ; en mode LCD_ASYNC, il s'agit de la durée de
+ *              l'appel et des interruptions LCD_AsyncTick() qui suivent (hors prologue et
+ *              épilogue de l'interruption).
+ *
+ *            Avec le busy flag, le driver rend la main dès l'écriture de la dernière instruction :
+ *            la mesure attend que le busy flag retombe, sans quoi l'exécution d'une instruction
+ *            longue (effacement) serait comptée dans l'opération suivante.
+ *
+ *            Le mode du driver mesuré (busy flag, temporisations, LCD_FAST_INIT, LCD_BUFFER,
+ *            LCD_ASYNC, LCD_READBACK) est choisi à la compilation (Cf. Makefile). En mode
+ *            LCD_ASYNC, LCD_InitializeAsync() est mesurée en plus de LCD_Initialize().
+ *
+ *            Format de sortie (une ligne par mesure, champs séparés par des ';') :
+ *            mode;opération;wall_us;cpu_us
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <util/atomic.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include <simavr/avr/avr_mcu_section.h>
+
+// Câblage de board.c : DB4..DB7 sur PD4..PD7, EN, R/W et RS sur PC0, PC1 et PC2
+#define LCD_INTERFACE_4BITS
+
+#define LCD_DATA_PORT           PORTD
+#define LCD_DATA_DDR            DDRD
+#define LCD_DATA_PIN            PIND
+
+#define LCD_CONTROL_PORT        PORTC
+#define LCD_CONTROL_DDR         DDRC
+
+#define LCD_CONTROL_EN_PIN      PORTC0
+#if !defined(BENCH_NO_RW)
+#  define LCD_CONTROL_RW_PIN    PORTC1
+#endif
+#define LCD_CONTROL_RS_PIN      PORTC2
+
+#include <LCD/Displaytech/162c.h>
+
+#if !defined(BENCH_MODE)
+#  define BENCH_MODE            "busy"
+#endif
+
+AVR_MCU(F_CPU, "atmega328p");
+AVR_MCU_SIMAVR_CONSOLE(&GPIOR0);
+
+// Ecrans successifs : le premier diffère entièrement de l'écran effacé, le second du premier
+// par 2 caractères seulement
+static const char screen_1[LCD_LINE_COUNT][LCD_DISPLAY_WIDTH + 1] = {
+  "Temp :   21.5 C ",
+  "Humid:    40 %  ",
+};
+static const char screen_2[LCD_LINE_COUNT][LCD_DISPLAY_WIDTH + 1] = {
+  "Temp :   21.7 C ",
+  "Humid:    41 %  ",
+};
+
+// Poids fort du compteur de cycles (débordements du timer 1)
+static volatile uint16_t overflows;
+
+ISR(TIMER1_OVF_vect)
+{
+  overflows++;
+}
+
+#if defined(LCD_ASYNC)
+// Cycles passés dans LCD_AsyncTick()
+static volatile uint32_t tick_cycles;
+
+ISR(TIMER0_COMPA_vect)
+{
+  uint16_t start = TCNT1;
+
+  LCD_AsyncTick();
+  tick_cycles += (uint16_t)(TCNT1 - start);
+}
+#endif
+
+/**
+ * @brief     Lit le compteur de cycles sur 32 bits
+ */
+static uint32_t Cycles(void)
+{
+  uint16_t high;
+  uint16_t low;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    low  = TCNT1;
+    high = overflows;
+    // Débordement non encore traité par l'interruption
+    if ((TIFR1 & _BV(TOV1)) && low < 0x8000)
+    {
+      high++;
+    }
+  }
+
+  return ((uint32_t)high << 16) | low;
+}
+
+static void PrintString(const char * string)
+{
+  while (*string)
+  {
+    GPIOR0 = *string++;
+  }
+}
+
+static void PrintNumber(uint32_t value)
+{
+  char string[11];
+
+  ultoa(value, string, 10);
+  PrintString(string);
+}
+
+static void Report(const char * operation, uint32_t wall, uint32_t cpu)
+{
+  PrintString(BENCH_MODE ";");
+  PrintString(operation);
+  PrintString(";");
+  PrintNumber(wall / (F_CPU / 1000000UL));
+  PrintString(";");
+  PrintNumber(cpu / (F_CPU / 1000000UL));
+  PrintString("\n");
+}
+
+// Coût de la mesure elle-même, retranché de chaque résultat
+static uint32_t overhead;
+
+/**
+ * @brief     Mesure une opération
+ *
+ * @param     [in]    name      Nom de l'opération
+ * @param     [in]    operation Fonction réalisant l'opération
+ */
+static void Measure(const char * name, void (*operation)(void))
+{
+  uint32_t start;
+  uint32_t wall;
+#if defined(LCD_ASYNC)
+  uint32_t call;
+  uint32_t ticks;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    tick_cycles = 0;
+  }
+
+  start = Cycles();
+  operation();
+  call  = Cycles() - start - overhead;
+
+  // Interruptions survenues pendant l'appel : déjà comptées dans sa durée
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    ticks = tick_cycles;
+  }
+  while (LCD_AsyncIsBusy());
+  wall = Cycles() - start - overhead;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    ticks = tick_cycles - ticks;
+  }
+  Report(name, wall, call + ticks);
+#else
+  start = Cycles();
+  operation();
+#  if defined(LCD_HAS_BUSY_FLAG)
+  // L'écriture de la dernière instruction rend la main avant son exécution
+  LCD_BusWaitReady(LCD_BUSY_TIMEOUT);
+#  endif
+  wall = Cycles() - start - overhead;
+  Report(name, wall, wall);
+#endif
+}
+
+static void OperationInitialize(void)
+{
+  LCD_Initialize();
+}
+
+#if defined(LCD_ASYNC)
+static void OperationInitializeAsync(void)
+{
+  LCD_InitializeAsync();
+}
+#endif
+
+static void OperationClear(void)
+{
+  LCD_DisplayClear();
+}
+
+static void OperationMoveCursor(void)
+{
+  LCD_MoveCursor(1, 0);
+}
+
+static void OperationPrintString(void)
+{
+  LCD_PrintString(screen_1[1]);
+}
+
+/**
+ * @brief     Affiche un écran complet, par la voie la plus rapide du mode mesuré
+ */
+static void Screen(const char screen[LCD_LINE_COUNT][LCD_DISPLAY_WIDTH + 1])
+{
+  for (uint8_t line = 0; line < LCD_LINE_COUNT; line++)
+  {
+#if defined(LCD_BUFFER)
+    LCD_BufferPrintString(line, 0, screen[line]);
+#elif defined(LCD_READBACK)
+    LCD_MoveCursor(line, 0);
+    LCD_UpdateString(screen[line]);
+#else
+    LCD_MoveCursor(line, 0);
+    LCD_PrintString(screen[line]);
+#endif
+  }
+#if defined(LCD_BUFFER)
+  LCD_Flush();
+#endif
+}
+
+static void OperationScreen(void)
+{
+  Screen(screen_1);
+}
+
+static void OperationScreenDelta(void)
+{
+  Screen(screen_2);
+}
+
+int main(void)
+{
+  uint32_t start;
+
+  // Timer 1 en mode libre, sans préscaler : 1 tick = 1 cycle CPU
+  TCCR1A = 0;
+  TCCR1B = _BV(CS10);
+  TIMSK1 = _BV(TOIE1);
+#if defined(LCD_ASYNC)
+  // Timer 0 en mode CTC, interruption toutes les 50 µs (préscaler 8)
+  TCCR0A = _BV(WGM01);
+  TCCR0B = _BV(CS01);
+  OCR0A  = (F_CPU / 8 / 1000000UL) * LCD_ASYNC_TICK_US - 1;
+  TIMSK0 = _BV(OCIE0A);
+#endif
+  sei();
+
+  start    = Cycles();
+  overhead = Cycles() - start;
+
+  Measure("LCD_Initialize",   OperationInitialize);
+#if defined(LCD_ASYNC)
+  // Mise sous tension par la file d'attente : cpu ne compte que l'appel et les interruptions
+  Measure("LCD_InitializeAsync", OperationInitializeAsync);
+#endif
+  Measure("LCD_MoveCursor",   OperationMoveCursor);
+  Measure("LCD_PrintString",  OperationPrintString);
+  Measure("LCD_DisplayClear", OperationClear);
+  // Ecran complet depuis l'écran effacé, puis écran voisin (2 caractères modifiés)
+  Measure("screen",           OperationScreen);
+  Measure("screen_delta",     OperationScreenDelta);
+
+  // simavr termine la simulation sur un sleep avec les interruptions désactivées
+  cli();
+  sleep_enable();
+  sleep_cpu();
+
+  return 0;
+}
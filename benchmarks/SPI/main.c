@@ -0,0 +1,161 @@
+/**
+ * @file      main.c
+ *
+ * @author    Zéro Cool
+ * @date      19/10/2026 09:09:25
+ * @brief     Benchmark des transferts SPI
+ *
+ * @details   Firmware de mesure des performances de SPI_master.h, destiné à être exécuté
+ *            sous simavr (ATmega328P). Pour chaque fonction de transfert et chaque taille
+ *            de transfert, le nombre de cycles est mesuré avec le timer 1 (sans préscaler)
+ *            puis le résultat est écrit sur la console simavr (registre GPIOR0).
+ *
+ *            Le backend mesuré (hardware et diviseur d'horloge, ou SPI_SOFTWARE) est choisi
+ *            à la compilation (Cf. Makefile).
+ *
+ *            Format de sortie (une ligne par mesure, champs séparés par des ';') :
+ *            backend;fonction;taille;cycles;cycles/octet;kbit/s
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include <simavr/avr/avr_mcu_section.h>
+
+#define SPI_DDR                 DDRB
+#define SPI_PORT                PORTB
+#define SPI_PIN                 PINB
+#define SPI_MOSI_PIN            PINB3
+#define SPI_MISO_PIN            PINB4
+#define SPI_SCK_PIN             PINB5
+#define SPI_SS_PIN              PINB2
+
+#include <SPI_master.h>
+
+#if !defined(BENCH_BACKEND)
+#  define BENCH_BACKEND         "hw"
+#endif
+
+AVR_MCU(F_CPU, "atmega328p");
+AVR_MCU_SIMAVR_CONSOLE(&GPIOR0);
+
+// Tailles de transfert mesurées
+static const uint16_t sizes[] = { 1, 4, 16, 64, 256 };
+
+static uint8_t buffer[256];
+
+// Poids fort du compteur de cycles (débordements du timer 1)
+static volatile uint16_t overflows;
+
+ISR(TIMER1_OVF_vect)
+{
+  overflows++;
+}
+
+/**
+ * @brief     Lit le compteur de cycles sur 32 bits
+ */
+static uint32_t Cycles(void)
+{
+  uint16_t high;
+  uint16_t low;
+
+  cli();
+  low  = TCNT1;
+  high = overflows;
+  // Débordement non encore traité par l'interruption
+  if ((TIFR1 & _BV(TOV1)) && low < 0x8000)
+  {
+    high++;
+  }
+  sei();
+
+  return ((uint32_t)high << 16) | low;
+}
+
+static void PrintString(const char * string)
+{
+  while (*string)
+  {
+    GPIOR0 = *string++;
+  }
+}
+
+static void PrintNumber(uint32_t value)
+{
+  char string[11];
+
+  ultoa(value, string, 10);
+  PrintString(string);
+}
+
+static void Report(const char * function, uint16_t size, uint32_t cycles)
+{
+  PrintString(BENCH_BACKEND ";");
+  PrintString(function);
+  PrintString(";");
+  PrintNumber(size);
+  PrintString(";");
+  PrintNumber(cycles);
+  PrintString(";");
+  PrintNumber(cycles / size);
+  PrintString(";");
+  // Débit en kbit/s : size * 8 bits / (cycles / F_CPU)
+  PrintNumber((uint32_t)size * 8 * (F_CPU / 1000) / cycles);
+  PrintString("\n");
+}
+
+int main(void)
+{
+  uint32_t start;
+  uint32_t overhead;
+
+  for (uint16_t i = 0; i < sizeof(buffer); i++)
+  {
+    buffer[i] = i;
+  }
+
+  // Timer 1 en mode libre, sans préscaler : 1 tick = 1 cycle CPU
+  TCCR1A = 0;
+  TCCR1B = _BV(CS10);
+  TIMSK1 = _BV(TOIE1);
+  sei();
+
+  SPI_Initialize();
+
+  // Coût de la mesure elle-même, retranché de chaque résultat
+  start    = Cycles();
+  overhead = Cycles() - start;
+
+  for (uint8_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+  {
+    uint16_t size = sizes[s];
+
+    SPI_EnableSlave();
+    start = Cycles();
+    for (uint16_t i = 0; i < size; i++)
+    {
+      SPI_SendByte(buffer[i]);
+    }
+    Report("SPI_SendByte", size, Cycles() - start - overhead);
+
+    start = Cycles();
+    SPI_SendBuffer(buffer, size);
+    Report("SPI_SendBuffer", size, Cycles() - start - overhead);
+
+    start = Cycles();
+    SPI_ReceiveBuffer(buffer, size);
+    Report("SPI_ReceiveBuffer", size, Cycles() - start - overhead);
+    SPI_DisableSlave();
+  }
+
+  // simavr termine la simulation sur un sleep avec les interruptions désactivées
+  cli();
+  sleep_enable();
+  sleep_cpu();
+
+  return 0;
+}
@@ -14,16 +14,197 @@
  * @warning   Toutes les broches data de l'afficheur LCD (DB0 à DB7) doivent être sur le
  *            même PORT du microcontroller.
  *
+ * @note      La définition de LCD_INTERFACE_4BITS active l'interface 4 bits : seules les broches
+ *            DB4 à DB7 de l'afficheur sont reliées, sur la moitié du PORT data indiquée par
+ *            LCD_DATA_SHIFT (4 : broches 4 à 7, valeur par défaut ; 0 : broches 0 à 3).
+ *            Les quatre autres broches du PORT restent libres : elles ne sont jamais modifiées
+ *            par le driver (écritures par lecture-modification-écriture du PORT).
+ *
+ * @note      La définition de LCD_TRANSPORT_PCF8574 remplace l'accès direct aux broches par un
+ *            expandeur I2C PCF8574 (module "backpack" I2C), basé sur I2C_master.h (SCL_CLOCK
+ *            doit être définie, 400 kHz au plus). L'interface 4 bits est alors imposée et les
+ *            broches LCD_DATA_xxx et LCD_CONTROL_xxx ne sont pas utilisées. L'adresse du
+ *            PCF8574 est donnée par LCD_PCF8574_ADDRESS (0x4E par défaut) et le câblage par
+ *            LCD_PCF8574_RS, LCD_PCF8574_RW, LCD_PCF8574_EN et LCD_PCF8574_BL (P0 à P3 par
+ *            défaut, DB4 à DB7 sur P4 à P7). Chaque octet de l'afficheur est transmis dans une
+ *            seule transaction I2C (les chaines de caractères dans une seule transaction), dont
+ *            la durée couvre le temps d'exécution des instructions : seules les commandes
+ *            longues (effacement, retour à l'origine) sont suivies d'une temporisation, ainsi
+ *            que les données au-delà de 391 kHz (complément de 1 µs au plus).
+ *
+ * @warning   Avec LCD_TRANSPORT_PCF8574 et LCD_ASYNC, le bus I2C est utilisé sous interruption :
+ *            l'application ne doit accéder aux autres périphériques I2C qu'avec les
+ *            interruptions désactivées.
+ *
+ * @note      La définition de LCD_TRANSPORT_PINMAP permet de relier chaque broche de l'afficheur à
+ *            une broche quelconque du microcontroller, sur des PORT différents. Chaque broche est
+ *            donnée par une paire PORT, bit : LCD_PIN_RS, LCD_PIN_EN, LCD_PIN_RW (facultative,
+ *            comme LCD_CONTROL_RW_PIN) et LCD_PIN_D4 à LCD_PIN_D7 (plus LCD_PIN_D0 à LCD_PIN_D3
+ *            en interface 8 bits). Les broches LCD_DATA_xxx et LCD_CONTROL_xxx ne sont alors pas
+ *            utilisées. Le câblage est résolu à la compilation : chaque accès à une broche est
+ *            une instruction sbi ou cbi (PORT A à G), sans table parcourue à l'exécution, et les
+ *            autres broches des PORT ne sont jamais modifiées :
+ * @code
+ * #define LCD_TRANSPORT_PINMAP
+ * #define LCD_INTERFACE_4BITS
+ * #define LCD_PIN_RS              B, 0
+ * #define LCD_PIN_RW              B, 1
+ * #define LCD_PIN_EN              D, 7
+ * #define LCD_PIN_D4              C, 2
+ * #define LCD_PIN_D5              C, 3
+ * #define LCD_PIN_D6              D, 2
+ * #define LCD_PIN_D7              D, 4
+ *
+ * #include <LCD/Displaytech/162c.h>
+ * @endcode
+ *
+ * @warning   Avec LCD_TRANSPORT_PINMAP, les broches situées sur des PORT hors de l'espace des
+ *            instructions sbi/cbi (PORT H à L des ATmega2560) sont écrites par
+ *            lecture-modification-écriture : les fonctions du LCD ne doivent alors pas être
+ *            appelées avec les interruptions actives si ces PORT sont modifiés sous interruption
+ *            (en dehors du mode LCD_ASYNC).
+ *
+ * @warning   En interface 4 bits, si les autres broches du PORT data sont modifiées sous
+ *            interruption, les fonctions du LCD ne doivent pas être appelées avec les
+ *            interruptions actives (en dehors du mode LCD_ASYNC).
+ *
  * @warning   Toutes les broches de controle de l'afficheur LCD (EN, R/W et RS)
  *            doivent être sur le même PORT du microcontroller.
  *
+ * @note      Lorsque la broche R/W est pilotée (LCD_CONTROL_RW_PIN et LCD_DATA_PIN définies),
+ *            le driver lit le busy flag de l'afficheur et chaque écriture est envoyée dès que
+ *            l'afficheur est prêt. Si la broche R/W de l'afficheur est reliée à la masse,
+ *            LCD_CONTROL_RW_PIN ne doit pas être définie : chaque instruction est alors suivie
+ *            de la temporisation correspondant à sa durée d'exécution maximale.
+ *
  * @note      Le buffer interne de l'afficheur LCD dispose de 80 caractères.
  *            L'écriture des 40 premiers caractères sont stockés sur la première ligne
  *            de l'afficheur. Les 40 caractères suivants sur la seconde ligne.
  *
- * @todo Faire fonctionner l'API en mode 4 bits
- * @todo Créer la fonction d'affichage d'un entier
- * @todo Créer la fonction d'affichage d'un double
+ * @note      La définition de LCD_BUFFER active une copie en RAM (80 octets + 10 octets
+ *            de suivi) de la mémoire d'affichage. L'application écrit librement dans cette
+ *            copie (LCD_BufferSetChar(), LCD_BufferPrintString(), ...) sans aucun accès à
+ *            l'afficheur, puis LCD_Flush() n'envoie à l'afficheur que les caractères
+ *            modifiés.
+ *
+ * @note      La définition de LCD_READBACK active la lecture de la mémoire de l'afficheur (DDRAM
+ *            et CGRAM) : LCD_ReadChar(), LCD_ReadCharacter(). Les fonctions LCD_Updatexxx()
+ *            n'écrivent que les caractères qui diffèrent de ceux déjà affichés : la mémoire de
+ *            l'afficheur sert de référence, sans copie en RAM (LCD_BUFFER). La broche R/W doit
+ *            être pilotée ; LCD_READBACK n'est disponible ni avec LCD_TRANSPORT_PCF8574, ni avec
+ *            LCD_ASYNC.
+ *
+ * @note      Plusieurs afficheurs (4 au plus) peuvent partager les broches data, RS et R/W, chacun
+ *            disposant de sa propre broche EN : LCD_DISPLAY_COUNT donne le nombre d'afficheurs,
+ *            LCD_CONTROL_EN_PIN la broche EN du premier, LCD_CONTROL_EN_PIN_1 à
+ *            LCD_CONTROL_EN_PIN_3 celles des suivants (sur LCD_CONTROL_PORT). Toutes les
+ *            fonctions s'appliquent à l'afficheur choisi par LCD_Select(). Chaque afficheur a
+ *            son propre état (curseur, mode d'insertion, copie en RAM, cache CGRAM, file
+ *            d'attente) : avec le busy flag ou en mode LCD_ASYNC, une instruction longue sur un
+ *            afficheur ne retarde pas les écritures vers les autres.
+ * @code
+ * #define LCD_DISPLAY_COUNT       2
+ * #define LCD_CONTROL_EN_PIN      PORTC0
+ * #define LCD_CONTROL_EN_PIN_1    PORTC3
+ *
+ * for (uint8_t i = 0; i < LCD_DISPLAY_COUNT; i++)
+ * {
+ *     LCD_Select(i);
+ *     LCD_Initialize();
+ * }
+ * @endcode
+ *
+ * @note      La définition de LCD_MARQUEE (avec LCD_ASYNC) active le défilement de textes de
+ *            longueur quelconque (255 caractères au plus), en RAM ou en mémoire flash, sur une
+ *            fenêtre de LCD_DISPLAY_WIDTH colonnes par ligne : LCD_MarqueeStart(). Le décalage et
+ *            la réécriture de la fenêtre sont réalisés par LCD_AsyncTick(), sans aucun temps
+ *            d'exécution dans la boucle principale. Une fenêtre n'est écrite que lorsque la file
+ *            d'attente est vide, le curseur étant replacé à sa position à la fin de l'écriture.
+ *
+ * @note      La définition de LCD_GRAPHICS active l'affichage de barres (LCD_DrawBar(), résolution
+ *            d'une colonne de points) et de grands chiffres sur 2 lignes (LCD_DrawBigDigit(),
+ *            LCD_DrawBigNumber()). Les caractères nécessaires sont enregistrés en CGRAM à la
+ *            première utilisation : adresses 0 à 3 pour les barres, 4 à 6 pour les grands
+ *            chiffres (l'adresse 7 reste libre). LCD_GRAPHICS requiert LCD_BUFFER : la copie en
+ *            RAM sert de référence, LCD_Drawxxx() n'envoyant immédiatement que les caractères qui
+ *            diffèrent de ceux affichés (une barre ou un nombre rafraîchi à 20 Hz ne réécrit que
+ *            les caractères modifiés). Les variantes LCD_BufferDrawxxx() écrivent dans la copie en
+ *            RAM : seuls les caractères modifiés sont envoyés par LCD_Flush(). Les caractères hors
+ *            de la mémoire d'affichage (colonne > 39) sont ignorés.
+ *
+ * @warning   Avec LCD_GRAPHICS, les adresses CGRAM 0 à 6 ne doivent pas être utilisées par
+ *            l'application (LCD_RegisterCharacter(), LCD_GlyphGet()) pendant l'affichage de
+ *            barres ou de grands chiffres.
+ *
+ * @note      La définition de LCD_GLYPH_CACHE active un cache des 8 adresses CGRAM (24 octets de
+ *            RAM) : LCD_GlyphGet() donne le code d'un caractère défini en mémoire flash, en ne
+ *            l'enregistrant en CGRAM que s'il n'y est pas déjà. L'adresse remplacée est la moins
+ *            récemment utilisée parmi celles qui ne sont pas affichées ; avec LCD_BUFFER, les
+ *            caractères présents dans la copie en RAM sont considérés comme affichés (sans
+ *            LCD_BUFFER, le driver ne sait pas ce qui est affiché : seul l'ordre d'utilisation
+ *            est pris en compte).
+ *
+ * @note      La définition de LCD_STREAM permet d'écrire sur l'afficheur avec les fonctions de
+ *            stdio (fprintf(), fputs(), ...) au travers d'un flux utilisant LCD_StreamPut().
+ *            Les caractères sont placés dans un buffer de LCD_STREAM_SIZE octets (16 par
+ *            défaut) envoyé en une seule rafale sur '\n', '\r', buffer plein ou appel de
+ *            LCD_StreamFlush() :
+ * @code
+ * #define LCD_STREAM
+ * #include <LCD/Displaytech/162c.h>
+ *
+ * static FILE lcd = FDEV_SETUP_STREAM(LCD_StreamPut, NULL, _FDEV_SETUP_WRITE);
+ *
+ * fprintf(&lcd, "\fTemp : %d C\nHumidite : %d%%", temperature, humidite);
+ * LCD_StreamFlush();
+ * @endcode
+ *
+ * @note      La définition de LCD_ASYNC active le mode asynchrone : les commandes et les
+ *            caractères sont placés dans une file d'attente (LCD_ASYNC_QUEUE_SIZE entrées)
+ *            et les fonctions rendent la main immédiatement. La file est vidée par
+ *            LCD_AsyncTick(), appelée périodiquement (toutes les LCD_ASYNC_TICK_US µs)
+ *            depuis une interruption timer, en respectant le temps d'exécution de chaque
+ *            instruction. Si LCD_ASYNC_TIMER_vect est définie, le driver définit lui-même
+ *            l'interruption correspondante ; la configuration du timer reste à la charge
+ *            de l'application. Lorsque la file est pleine, les fonctions attendent qu'une
+ *            place se libère (les interruptions doivent donc être actives). LCD_Initialize()
+ *            et LCD_SoftwareReset() restent bloquantes ; LCD_InitializeAsync() place la
+ *            séquence de mise sous tension dans la file d'attente et rend la main
+ *            immédiatement :
+ * @code
+ * #define LCD_ASYNC
+ * #define LCD_ASYNC_TICK_US       50
+ * #define LCD_ASYNC_TIMER_vect    TIMER0_COMPA_vect
+ *
+ * #include <LCD/Displaytech/162c.h>
+ *
+ * // Timer 0 en mode CTC, interruption toutes les 50 µs (F_CPU = 16 MHz, préscaler 8)
+ * TCCR0A = _BV(WGM01);
+ * TCCR0B = _BV(CS01);
+ * OCR0A  = 99;
+ * TIMSK0 = _BV(OCIE0A);
+ * sei();
+ *
+ * LCD_InitializeAsync();
+ * LCD_PrintString("Demarrage...");
+ * // Suite de l'initialisation du firmware pendant la mise sous tension de l'afficheur
+ * @endcode
+ *
+ * @note      L'afficheur n'accepte aucune instruction pendant sa mise sous tension :
+ *            LCD_Initialize() attend LCD_POWER_ON_MS ms (15 par défaut : valeur de la datasheet
+ *            pour une alimentation de 5 V, 40 ms pour 3 V). La définition de LCD_FAST_INIT (avec
+ *            la broche R/W pilotée) remplace cette attente par la lecture du busy flag, qui reste
+ *            à 1 pendant la réinitialisation interne de l'afficheur (DB7 est tirée à l'état haut
+ *            tant que l'afficheur n'est pas alimenté) : LCD_Initialize() se termine dès que
+ *            l'afficheur est prêt. Lorsque cette réinitialisation est constatée, l'interface est
+ *            en mode 8 bits et la séquence d'initialisation par instructions (plus de 4 ms) est
+ *            inutile. Sinon (busy flag à 0 dès la première lecture, afficheur déjà alimenté ou
+ *            DB7 maintenue à l'état bas, ou busy flag jamais retombé), LCD_Initialize() revient
+ *            à la séquence de la datasheet : attente de LCD_POWER_ON_MS ms puis initialisation
+ *            par instructions.
+ *
+ * @warning   Avec LCD_FAST_INIT, la réinitialisation interne suppose une montée de
+ *            l'alimentation de l'afficheur conforme à la datasheet (moins de 10 ms).
  *
  * Exemple d'utilisation :
  * @code
@@ -34,6 +215,7 @@
 // PORT sur lequel est branché le port DATA du LCD (Broches DB0 à DB7 de l'afficheur LCD)
 #define LCD_DATA_PORT			PORTD
 #define LCD_DATA_DDR			DDRD
+#define LCD_DATA_PIN			PIND
 
 // PORT sur lequel est branché les pins du contrôle du LCD
 #define LCD_CONTROL_PORT		PORTC
@@ -115,35 +297,232 @@ int main(void)
 #ifndef _162C_H_
 #define _162C_H_
 
-#if !defined(LCD_DATA_PORT)
-#  error "162c.h requied que LCD_DATA_PORT soit définie"
+#if defined(LCD_TRANSPORT_PCF8574)
+// Le PCF8574 ne relie que DB4..DB7
+#  if !defined(LCD_INTERFACE_4BITS)
+#    define LCD_INTERFACE_4BITS
+#  endif
+
+/**
+ * @brief     Adresse I2C du PCF8574 (en écriture, bit R/W inclus)
+ */
+#  if !defined(LCD_PCF8574_ADDRESS)
+#    define LCD_PCF8574_ADDRESS   0x4E
+#  endif
+
+/**
+ * @brief     Masques des broches P0 à P3 du PCF8574 reliées à RS, R/W, EN et au rétroéclairage
+ * @details   DB4 à DB7 sont reliées aux broches P4 à P7
+ */
+#  if !defined(LCD_PCF8574_RS)
+#    define LCD_PCF8574_RS        0x01
+#  endif
+#  if !defined(LCD_PCF8574_RW)
+#    define LCD_PCF8574_RW        0x02
+#  endif
+#  if !defined(LCD_PCF8574_EN)
+#    define LCD_PCF8574_EN        0x04
+#  endif
+#  if !defined(LCD_PCF8574_BL)
+#    define LCD_PCF8574_BL        0x08
+#  endif
+#elif defined(LCD_TRANSPORT_PINMAP)
+#  if !defined(LCD_PIN_RS)
+#    error "162c.h requied que LCD_PIN_RS soit définie"
+#  endif
+
+#  if !defined(LCD_PIN_EN)
+#    error "162c.h requied que LCD_PIN_EN soit définie"
+#  endif
+
+#  if !defined(LCD_PIN_D4) || !defined(LCD_PIN_D5) || !defined(LCD_PIN_D6) || !defined(LCD_PIN_D7)
+#    error "162c.h requied que LCD_PIN_D4 à LCD_PIN_D7 soient définies"
+#  endif
+
+#  if !defined(LCD_INTERFACE_4BITS) && \
+      (!defined(LCD_PIN_D0) || !defined(LCD_PIN_D1) || !defined(LCD_PIN_D2) || !defined(LCD_PIN_D3))
+#    error "162c.h requied que LCD_PIN_D0 à LCD_PIN_D3 soient définies"
+#  endif
+#else
+#  if !defined(LCD_DATA_PORT)
+#    error "162c.h requied que LCD_DATA_PORT soit définie"
+#  endif
+
+#  if !defined(LCD_DATA_DDR)
+#    error "162c.h requied que LCD_DATA_DDR soit définie"
+#  endif
+
+#  if !defined(LCD_CONTROL_PORT)
+#    error "162c.h requied que LCD_CONTROL_PORT soit définie"
+#  endif
+
+#  if !defined(LCD_CONTROL_DDR)
+#    error "162c.h requied que LCD_CONTROL_DDR soit définie"
+#  endif
+
+#  if !defined(LCD_CONTROL_EN_PIN)
+#    error "162c.h requied que LCD_CONTROL_EN_PIN soit définie"
+#  endif
+
+#  if defined(LCD_CONTROL_RW_PIN) && !defined(LCD_DATA_PIN)
+#    error "162c.h requied que LCD_DATA_PIN soit définie"
+#  endif
+
+#  if !defined(LCD_CONTROL_RS_PIN)
+#    error "162c.h requied que LCD_CONTROL_RS_PIN soit définie"
+#  endif
 #endif
 
-#if !defined(LCD_DATA_DDR)
-#  error "162c.h requied que LCD_DATA_DDR soit définie"
+/**
+ * @brief     Nombre d'afficheurs partageant le bus
+ */
+#if !defined(LCD_DISPLAY_COUNT)
+#  define LCD_DISPLAY_COUNT       1
 #endif
 
-#if !defined(LCD_CONTROL_PORT)
-#  error "162c.h requied que LCD_CONTROL_PORT soit définie"
+#if LCD_DISPLAY_COUNT < 1 || LCD_DISPLAY_COUNT > 4
+#  error "LCD_DISPLAY_COUNT doit être compris entre 1 et 4"
 #endif
 
-#if !defined(LCD_CONTROL_DDR)
-#  error "162c.h requied que LCD_CONTROL_DDR soit définie"
+#if LCD_DISPLAY_COUNT > 1
+#  if defined(LCD_TRANSPORT_PCF8574)
+#    error "LCD_DISPLAY_COUNT > 1 n'est pas disponible avec LCD_TRANSPORT_PCF8574"
+#  endif
+
+#  if defined(LCD_TRANSPORT_PINMAP)
+#    error "LCD_DISPLAY_COUNT > 1 n'est pas disponible avec LCD_TRANSPORT_PINMAP"
+#  endif
+
+#  if !defined(LCD_CONTROL_EN_PIN_1)
+#    error "162c.h requied que LCD_CONTROL_EN_PIN_1 soit définie"
+#  endif
+
+#  if LCD_DISPLAY_COUNT > 2 && !defined(LCD_CONTROL_EN_PIN_2)
+#    error "162c.h requied que LCD_CONTROL_EN_PIN_2 soit définie"
+#  endif
+
+#  if LCD_DISPLAY_COUNT > 3 && !defined(LCD_CONTROL_EN_PIN_3)
+#    error "162c.h requied que LCD_CONTROL_EN_PIN_3 soit définie"
+#  endif
 #endif
 
-#if !defined(LCD_CONTROL_EN_PIN)
-#  error "162c.h requied que LCD_CONTROL_EN_PIN soit définie"
+#if defined(LCD_INTERFACE_4BITS) && !defined(LCD_TRANSPORT_PCF8574) && !defined(LCD_TRANSPORT_PINMAP)
+/**
+ * @brief     Position de DB4 sur le PORT data en interface 4 bits
+ */
+#  if !defined(LCD_DATA_SHIFT)
+#    define LCD_DATA_SHIFT        4
+#  endif
+
+#  if LCD_DATA_SHIFT != 0 && LCD_DATA_SHIFT != 4
+#    error "LCD_DATA_SHIFT doit valoir 0 ou 4"
+#  endif
 #endif
 
-#if !defined(LCD_CONTROL_RW_PIN)
-#  error "162c.h requied que LCD_CONTROL_RW_PIN soit définie"
+#if defined(LCD_ASYNC)
+#  if !defined(LCD_ASYNC_TICK_US)
+#    error "162c.h requied que LCD_ASYNC_TICK_US soit définie"
+#  endif
+
+/**
+ * @brief     Nombre d'entrées de la file d'attente du mode asynchrone
+ */
+#  if !defined(LCD_ASYNC_QUEUE_SIZE)
+#    define LCD_ASYNC_QUEUE_SIZE  32
+#  endif
+
+#  if (LCD_ASYNC_QUEUE_SIZE & (LCD_ASYNC_QUEUE_SIZE - 1)) || LCD_ASYNC_QUEUE_SIZE > 128
+#    error "LCD_ASYNC_QUEUE_SIZE doit être une puissance de 2 inférieure ou égale à 128"
+#  endif
+#endif
+
+#if defined(LCD_STREAM)
+/**
+ * @brief     Nombre de caractères du buffer du flux stdio
+ */
+#  if !defined(LCD_STREAM_SIZE)
+#    define LCD_STREAM_SIZE       16
+#  endif
+#endif
+
+#if defined(LCD_GRAPHICS) && !defined(LCD_BUFFER)
+#  error "LCD_GRAPHICS requiert LCD_BUFFER"
+#endif
+
+#if defined(LCD_MARQUEE)
+#  if !defined(LCD_ASYNC)
+#    error "LCD_MARQUEE requiert LCD_ASYNC"
+#  endif
+
+/**
+ * @brief     Nombre d'espaces séparant deux répétitions d'un texte défilant
+ */
+#  if !defined(LCD_MARQUEE_GAP)
+#    define LCD_MARQUEE_GAP       3
+#  endif
+#endif
+
+/**
+ * @brief     Durée de la mise sous tension de l'afficheur (en ms)
+ * @details   Durée attendue par LCD_Initialize() ; durée maximale de la lecture du busy flag
+ *            avec LCD_FAST_INIT
+ */
+#if !defined(LCD_POWER_ON_MS)
+#  define LCD_POWER_ON_MS         15
+#endif
+
+#if defined(LCD_FAST_INIT)
+#  if defined(LCD_TRANSPORT_PCF8574)
+#    error "LCD_FAST_INIT n'est pas disponible avec LCD_TRANSPORT_PCF8574"
+#  endif
+
+#  if !defined(LCD_CONTROL_RW_PIN) && !defined(LCD_PIN_RW)
+#    error "LCD_FAST_INIT requiert que la broche R/W soit pilotée (LCD_CONTROL_RW_PIN ou LCD_PIN_RW)"
+#  endif
 #endif
 
-#if !defined(LCD_CONTROL_RS_PIN)
-#  error "162c.h requied que LCD_CONTROL_RS_PIN soit définie"
+#if defined(LCD_READBACK)
+#  if defined(LCD_TRANSPORT_PCF8574)
+#    error "LCD_READBACK n'est pas disponible avec LCD_TRANSPORT_PCF8574"
+#  endif
+
+#  if defined(LCD_ASYNC)
+#    error "LCD_READBACK n'est pas disponible avec LCD_ASYNC"
+#  endif
+
+#  if !defined(LCD_CONTROL_RW_PIN) && !defined(LCD_PIN_RW)
+#    error "LCD_READBACK requiert que la broche R/W soit pilotée (LCD_CONTROL_RW_PIN ou LCD_PIN_RW)"
+#  endif
 #endif
 
 #include <stdint.h>
+#if defined(LCD_STREAM)
+#  include <stdio.h>
+#endif
+
+/**
+ * @brief     Séparateur décimal utilisé par LCD_PrintFixed()
+ */
+#if !defined(LCD_DECIMAL_POINT)
+#  define LCD_DECIMAL_POINT       '.'
+#endif
+
+/**
+ * @brief     Nombre de lignes de la mémoire d'affichage (DDRAM)
+ */
+#define LCD_LINE_COUNT            2
+
+/**
+ * @brief     Nombre de caractères par ligne de la mémoire d'affichage (DDRAM)
+ */
+#define LCD_LINE_LENGTH           40
+
+/**
+ * @brief     Nombre de caractères visibles par ligne
+ */
+#if !defined(LCD_DISPLAY_WIDTH)
+#  define LCD_DISPLAY_WIDTH       16
+#endif
 
 /**
  * @brief     Directions d'écriture du LCD
@@ -221,6 +600,37 @@ typedef enum
     LCD_CGRAM_07 = 0x07,            /**< Adresse 0b00000111 (0x07) */
 } LCD_CGRAM;
 
+/**
+ * @brief     Caractères de remplissage des nombres
+ * @details   Enumération des caractères placés à gauche d'un nombre plus court que la largeur demandée
+ */
+typedef enum
+{
+    LCD_FILL_SPACE = ' ',           /**< Remplissage par des espaces (signe accolé au nombre) */
+    LCD_FILL_ZERO  = '0'            /**< Remplissage par des zéros (signe en première position) */
+} LCD_FILL;
+
+#if LCD_DISPLAY_COUNT > 1
+
+/**
+ * @brief      Sélectionne l'afficheur auquel s'appliquent les fonctions du LCD
+ * @details    Fonction disponible uniquement si LCD_DISPLAY_COUNT est supérieure à 1.
+ *             L'afficheur 0 est sélectionné au démarrage.
+ *
+ * @param      [in]      display      Numéro de l'afficheur (0 à LCD_DISPLAY_COUNT - 1)
+ *
+ * @warning    Le numéro de l'afficheur n'est pas vérifié.
+ *
+ * Exemple :
+ * @code
+ * LCD_Select(1);
+ * LCD_PrintString("Afficheur 2");
+ * @endcode
+ */
+void LCD_Select(const uint8_t display);
+
+#endif
+
 /**
  * @brief      Initialise l'afficheur LCD
  *
@@ -228,6 +638,13 @@ typedef enum
  *             l'utilisation
  *
  * @note       Cette fonction est à appeler avant toute utilisation du LCD
+ *             (pour chaque afficheur si LCD_DISPLAY_COUNT est supérieure à 1)
+ * @warning    En mode LCD_ASYNC, la fonction attend que les files d'attente de tous les
+ *             afficheurs soient vides : les interruptions doivent être actives pour initialiser
+ *             un afficheur lorsqu'un autre a déjà été initialisé.
+ * @note       Le curseur est replacé en première ligne, première colonne, en mode incrémental
+ *             et sans décalage de l'affichage : position et décalage sont ensuite suivis par
+ *             le driver.
  *
  * Exemple :
  * @code
@@ -286,6 +703,107 @@ void LCD_PrintChar(const unsigned char character);
  */
 void LCD_PrintString(const char * string);
 
+/**
+ * @brief      Ecrit une chaine de caractères stockée en mémoire flash sur le LCD
+ * @details    Identique à LCD_PrintString(), la chaine n'occupant pas de RAM.
+ *
+ * @param      [in]      string    Chaine de caractères stockée en mémoire flash
+ *
+ * Exemple :
+ * @code
+ *    LCD_PrintString_P(PSTR("Hello World"));
+ * @endcode
+ */
+void LCD_PrintString_P(const char * string);
+
+/**
+ * @brief      Affiche un écran complet stocké en mémoire flash
+ * @details    Fonction permettant d'afficher un modèle d'écran (libellés fixes) en un seul envoi :
+ *             les LCD_DISPLAY_WIDTH premiers caractères de chaque ligne sont écrits à la suite,
+ *             avec une seule commande de positionnement par ligne. Les champs variables sont
+ *             ensuite écrits par LCD_MoveCursor() et LCD_PrintString(), LCD_PrintUInt(), ...
+ *
+ * @param      [in]      screen    Modèle d'écran en mémoire flash : LCD_LINE_COUNT lignes de
+ *                                 LCD_DISPLAY_WIDTH caractères, sans séparateur
+ *
+ * @note       Le modèle est écrit à partir de la colonne 0 de la mémoire d'affichage, visible
+ *             en première colonne si l'affichage n'est pas décalé.
+ *
+ * Exemple :
+ * @code
+ * const char screen_temp[] PROGMEM =
+ *     "Temp :       C  "
+ *     "Consigne :   C  ";
+ *
+ * LCD_PrintScreen_P(screen_temp);
+ * LCD_MoveCursor(0, 7);
+ * LCD_PrintInt(temperature, 4, LCD_FILL_SPACE);
+ * @endcode
+ */
+void LCD_PrintScreen_P(const char * screen);
+
+/**
+ * @brief      Ecrit un entier non signé sur le LCD
+ * @details    Fonction permettant d'écrire un entier en décimal sans utiliser printf. Les chiffres
+ *             sont extraits par soustractions successives, sans division.
+ *
+ * @param      [in]      value        Entier à écrire
+ * @param      [in]      width        Largeur minimale (alignement à droite), 0 pour aucune,
+ *                                    16 au plus
+ * @param      [in]      fill         Caractère de remplissage à gauche
+ *
+ * Exemple pour écrire "  42" :
+ * @code
+ *    LCD_PrintUInt(42, 4, LCD_FILL_SPACE);
+ * @endcode
+ */
+void LCD_PrintUInt(const uint16_t value, const uint8_t width, const LCD_FILL fill);
+
+/**
+ * @brief      Ecrit un entier signé sur le LCD
+ *
+ * @param      [in]      value        Entier à écrire
+ * @param      [in]      width        Largeur minimale, signe compris (alignement à droite)
+ * @param      [in]      fill         Caractère de remplissage à gauche
+ *
+ * Exemple pour écrire "-007" :
+ * @code
+ *    LCD_PrintInt(-7, 4, LCD_FILL_ZERO);
+ * @endcode
+ */
+void LCD_PrintInt(const int16_t value, const uint8_t width, const LCD_FILL fill);
+
+/**
+ * @brief      Ecrit un nombre à virgule fixe sur le LCD
+ * @details    Fonction remplaçant l'affichage d'un double : la valeur est un entier exprimé en
+ *             1/10^decimals, affiché avec le séparateur LCD_DECIMAL_POINT.
+ *
+ * @param      [in]      value        Valeur en 1/10^decimals
+ * @param      [in]      decimals     Nombre de chiffres après la virgule (0 à 4)
+ * @param      [in]      width        Largeur minimale, signe et séparateur compris
+ * @param      [in]      fill         Caractère de remplissage à gauche
+ *
+ * Exemple pour écrire " 21.50" à partir d'une température en centièmes de degré :
+ * @code
+ *    LCD_PrintFixed(2150, 2, 6, LCD_FILL_SPACE);
+ * @endcode
+ */
+void LCD_PrintFixed(const int16_t value, const uint8_t decimals, const uint8_t width, const LCD_FILL fill);
+
+/**
+ * @brief      Ecrit un entier en hexadécimal sur le LCD
+ *
+ * @param      [in]      value        Entier à écrire
+ * @param      [in]      width        Largeur minimale (alignement à droite)
+ * @param      [in]      fill         Caractère de remplissage à gauche
+ *
+ * Exemple pour écrire "00FF" :
+ * @code
+ *    LCD_PrintHex(0xFF, 4, LCD_FILL_ZERO);
+ * @endcode
+ */
+void LCD_PrintHex(const uint16_t value, const uint8_t width, const LCD_FILL fill);
+
 /**
  * @brief      Positionne le curseur à la première ligne, première colonne d'écriture du LCD
  *
@@ -356,7 +874,10 @@ void LCD_SetFunction(const LCD_LINES lines, const LCD_POLICE police);
 
 /**
  * @brief      Déplace le curseur sur la droite
- * @details    Fonction permettant de déplacer le curseur du LCD sur la droite
+ * @details    Fonction permettant de déplacer le curseur du LCD sur la droite. La position du
+ *             curseur étant suivie par le driver, le déplacement est réalisé par une seule
+ *             commande de positionnement, quelle que soit sa longueur. Comme avec l'afficheur,
+ *             le curseur passe de la fin de la première ligne au début de la seconde.
  *
  * @param      [in]      count            Indique le nombre de caractères de déplacement
  *
@@ -369,7 +890,8 @@ void LCD_MoveCursorRight(uint8_t count);
 
 /**
  * @brief      Déplace le curseur sur la gauche
- * @details    Fonction permettant de déplacer le curseur du LCD sur la gauche
+ * @details    Fonction permettant de déplacer le curseur du LCD sur la gauche, par une seule
+ *             commande de positionnement.
  *
  * @param      [in]      count            Indique le nombre de caractères de déplacement
  *
@@ -382,7 +904,9 @@ void LCD_MoveCursorLeft(uint8_t count);
 
 /**
  * @brief      Déplace l'affichage sur la droite
- * @details    Fonction permettant de déplacer l'affichage du LCD sur la droite à patir de la position courante du curseur
+ * @details    Fonction permettant de déplacer l'affichage du LCD sur la droite à patir de la position courante du curseur.
+ *             Le nombre de décalages envoyés est réduit au plus court sur les 40 colonnes de
+ *             la mémoire d'affichage (un déplacement de 38 à droite équivaut à 2 à gauche).
  *
  * @param      [in]      count            Indique le nombre de caractères de déplacement
  *
@@ -395,7 +919,9 @@ void LCD_MoveDisplayRight(uint8_t count);
 
 /**
  * @brief      Déplace l'affichage sur la gauche
- * @details    Fonction permettant de déplacer l'affichage du LCD sur la gauche à patir de la position courante du curseur
+ * @details    Fonction permettant de déplacer l'affichage du LCD sur la gauche à patir de la position courante du curseur.
+ *             Le nombre de décalages envoyés est réduit au plus court sur les 40 colonnes de
+ *             la mémoire d'affichage.
  *
  * @param      [in]      count            Indique le nombre de caractères de déplacement
  *
@@ -406,9 +932,26 @@ void LCD_MoveDisplayRight(uint8_t count);
  */
 void LCD_MoveDisplayLeft(uint8_t count);
 
+/**
+ * @brief      Positionne le décalage de l'affichage
+ * @details    Fonction permettant de décaler l'affichage pour que la colonne offset de la mémoire
+ *             d'affichage soit affichée en première colonne. Le décalage est atteint dans le sens
+ *             le plus court (au plus 20 commandes de décalage).
+ *
+ * @param      [in]      offset           Colonne de la mémoire d'affichage à afficher en première
+ *                                        colonne (0 à 39)
+ *
+ * Exemple pour afficher les colonnes 16 à 31 :
+ * @code
+ * LCD_SetDisplayOffset(16);
+ * @endcode
+ */
+void LCD_SetDisplayOffset(uint8_t offset);
+
 /**
  * @brief      Déplace le curseur
- * @details    Fonction permettant de déplacer le curseur sur le LCD
+ * @details    Fonction permettant de déplacer le curseur sur le LCD. Aucune commande n'est
+ *             envoyée si le curseur est déjà à la position demandée.
  *
  * @param      [in]      line             Indique le numéro de ligne sur laquelle placer le curseur (indice de base 0)
  * @param      [in]      column           Indique le numéro de la ligne sur laquelle placer le curseur (indice de base 0)
@@ -435,7 +978,8 @@ void LCD_SoftwareReset(void);
 
 /**
  * @brief      Enregistre un caractère en CGRAM
- * @details    Fonction permettant d'enregistrer un caratère en CGRAM du LCD
+ * @details    Fonction permettant d'enregistrer un caratère en CGRAM du LCD. L'adresse CGRAM
+ *             n'est envoyée qu'une fois, les 8 lignes du caractère étant écrites à la suite.
  *
  * @param      [in]       address         Donne l'adresse en CGRAM où enregistrer le caractère
  * @param      [in]       data            Tableau d'octets contenant la représentation du caractère.
@@ -443,6 +987,7 @@ void LCD_SoftwareReset(void);
  *                                        seul les 5 bits de poids faibles sont utilisés.
  *
  * @note       Seul 8 caractères différents peuvent être enresitrés (8 adresses disponibles)
+ * @note       Le curseur est replacé à sa position en DDRAM après l'enregistrement
  *
  * @warning    Il n'y a aucun contrôle de dépassement de capacité
  *
@@ -479,6 +1024,7 @@ void LCD_RegisterCharacter(const LCD_CGRAM address, const uint8_t data[]);
  *                                        seul les 5 bits de poids faibles sont utilisés.
  *
  * @note       Seul 8 caractères différents peuvent être enresitrés (8 adresses disponibles)
+ * @note       Le curseur est replacé à sa position en DDRAM après l'enregistrement
  *
  * @warning    Il n'y a aucun contrôle de dépassement de capacité
  *
@@ -503,6 +1049,583 @@ void LCD_RegisterCharacter(const LCD_CGRAM address, const uint8_t data[]);
  */
 void LCD_RegisterCharacter_P(const LCD_CGRAM address, const uint8_t data[]);
 
+/**
+ * @brief      Enregistre plusieurs caractères consécutifs en CGRAM
+ * @details    Fonction permettant d'enregistrer jusqu'à 8 caractères (une page complète de
+ *             64 octets) en une seule rafale : l'adresse CGRAM n'est envoyée qu'une fois.
+ *
+ * @param      [in]       address         Adresse en CGRAM du premier caractère
+ * @param      [in]       data            Tableau d'octets contenant la représentation des caractères,
+ *                                        8 occurences par caractère
+ * @param      [in]       count           Nombre de caractères à enregistrer
+ *
+ * @note       Le curseur est replacé à sa position en DDRAM après l'enregistrement
+ *
+ * @warning    Il n'y a aucun contrôle de dépassement de capacité (address + count <= 8)
+ *
+ * Exemple pour enregistrer 3 caractères en CGRAM 0x00, 0x01 et 0x02 :
+ * @code
+ * const uint8_t font[3 * 8] = { ... };
+ *
+ * LCD_RegisterCharacters(LCD_CGRAM_00, font, 3);
+ * @endcode
+ */
+void LCD_RegisterCharacters(const LCD_CGRAM address, const uint8_t data[], const uint8_t count);
+
+/**
+ * @brief      Enregistre plusieurs caractères consécutifs en CGRAM depuis la mémoire flash
+ * @details    Identique à LCD_RegisterCharacters(), la représentation des caractères étant
+ *             stockée en mémoire flash.
+ *
+ * @param      [in]       address         Adresse en CGRAM du premier caractère
+ * @param      [in]       data            Tableau d'octets stocké en mémoire flash contenant la
+ *                                        représentation des caractères, 8 occurences par caractère
+ * @param      [in]       count           Nombre de caractères à enregistrer
+ *
+ * @note       Le curseur est replacé à sa position en DDRAM après l'enregistrement
+ *
+ * @warning    Il n'y a aucun contrôle de dépassement de capacité (address + count <= 8)
+ *
+ * Exemple pour enregistrer une page complète de 8 caractères :
+ * @code
+ * const uint8_t font[8 * 8] PROGMEM = { ... };
+ *
+ * LCD_RegisterCharacters_P(LCD_CGRAM_00, font, 8);
+ * @endcode
+ */
+void LCD_RegisterCharacters_P(const LCD_CGRAM address, const uint8_t data[], const uint8_t count);
+
+#if defined(LCD_READBACK)
+
+/**
+ * @brief      Lit le caractère à la position du curseur
+ * @details    Le curseur avance (ou recule, selon le mode d'insertion) comme après une écriture,
+ *             sans décalage de l'affichage.
+ *
+ * @return     Code du caractère lu
+ *
+ * Exemple :
+ * @code
+ * LCD_MoveCursor(0, 5);
+ * uint8_t character = LCD_ReadChar();
+ * @endcode
+ */
+uint8_t LCD_ReadChar(void);
+
+/**
+ * @brief      Lit un caractère enregistré en CGRAM
+ *
+ * @param      [in]       address         Adresse CGRAM du caractère (LCD_CGRAM_xx)
+ * @param      [out]      data            Tableau de 8 octets recevant la représentation du caractère
+ *
+ * @note       Le curseur est replacé à sa position en DDRAM après la lecture
+ */
+void LCD_ReadCharacter(const LCD_CGRAM address, uint8_t data[]);
+
+/**
+ * @brief      Ecrit un caractère sur le LCD s'il n'y est pas déjà
+ * @details    Le caractère affiché à la position du curseur est lu et n'est remplacé que s'il
+ *             diffère. Le curseur avance dans tous les cas.
+ *
+ * @param      [in]       character       Caractère à afficher
+ *
+ * @note       Le mode d'insertion doit être sans décalage de l'affichage.
+ */
+void LCD_UpdateChar(const unsigned char character);
+
+/**
+ * @brief      Ecrit une chaine de caractères sur le LCD en ne modifiant que les caractères qui diffèrent
+ * @details    Les caractères affichés sont lus par blocs de 8, puis seuls ceux qui diffèrent sont
+ *             écrits : une commande de positionnement est envoyée avant chaque bloc lu et au
+ *             début de chaque suite de caractères modifiés. Une chaine déjà affichée ne coûte
+ *             que des lectures.
+ *
+ * @param      [in]       string          Chaine de caractères à afficher (255 caractères au plus)
+ *
+ * @note       Le curseur est laissé après le dernier caractère de la chaine.
+ * @note       Le mode d'insertion doit être sans décalage de l'affichage.
+ *
+ * Exemple :
+ * @code
+ * // Rafraîchissement périodique : seuls les chiffres modifiés sont écrits
+ * LCD_MoveCursor(0, 0);
+ * LCD_UpdateString(text);
+ * @endcode
+ */
+void LCD_UpdateString(const char * string);
+
+/**
+ * @brief      Ecrit une chaine de caractères stockée en mémoire flash sur le LCD en ne modifiant que
+ *             les caractères qui diffèrent
+ * @details    Identique à LCD_UpdateString(), la chaine étant lue en mémoire flash
+ *
+ * @param      [in]       string          Chaine de caractères (en mémoire flash) à afficher
+ */
+void LCD_UpdateString_P(const char * string);
+
+/**
+ * @brief      Affiche un écran complet stocké en mémoire flash en ne modifiant que les caractères
+ *             qui diffèrent
+ * @details    Identique à LCD_PrintScreen_P(), seuls les caractères qui diffèrent de ceux
+ *             affichés étant écrits : le passage d'un écran à un écran voisin ne coûte que les
+ *             lectures et les caractères modifiés.
+ *
+ * @param      [in]       screen          LCD_LINE_COUNT x LCD_DISPLAY_WIDTH caractères (en mémoire flash)
+ */
+void LCD_UpdateScreen_P(const char * screen);
+
+#endif
+
+#if defined(LCD_BUFFER)
+
+/**
+ * @brief      Efface la copie en RAM de l'afficheur
+ * @details    Remplit la copie en RAM de l'afficheur avec des espaces.
+ *             Seuls les caractères qui n'étaient pas des espaces seront envoyés lors
+ *             du prochain LCD_Flush().
+ *
+ * Exemple :
+ * @code
+ * LCD_BufferClear();
+ * @endcode
+ */
+void LCD_BufferClear(void);
+
+/**
+ * @brief      Ecrit un caractère dans la copie en RAM de l'afficheur
+ * @details    Le caractère n'est envoyé à l'afficheur qu'au prochain LCD_Flush(), et
+ *             seulement s'il diffère du caractère affiché.
+ *
+ * @param      [in]      line         Numéro de ligne (indice de base 0)
+ * @param      [in]      column       Numéro de colonne (indice de base 0, 0 à 39)
+ * @param      [in]      character    Caractère à écrire
+ *
+ * @note       Un caractère hors de la mémoire d'affichage (ligne > 1 ou colonne > 39) est ignoré.
+ *
+ * Exemple :
+ * @code
+ * LCD_BufferSetChar(1, 15, '*');
+ * @endcode
+ */
+void LCD_BufferSetChar(const uint8_t line, const uint8_t column, const unsigned char character);
+
+/**
+ * @brief      Ecrit une chaine de caractères dans la copie en RAM de l'afficheur
+ *
+ * @param      [in]      line         Numéro de ligne (indice de base 0)
+ * @param      [in]      column       Numéro de colonne du premier caractère (indice de base 0)
+ * @param      [in]      string       Chaine de caractères à écrire
+ *
+ * @note       L'écriture s'arrête à la fin de la ligne (colonne 39).
+ *
+ * Exemple :
+ * @code
+ * LCD_BufferPrintString(0, 0, "Temp : 21 C");
+ * @endcode
+ */
+void LCD_BufferPrintString(const uint8_t line, const uint8_t column, const char * string);
+
+/**
+ * @brief      Ecrit une chaine de caractères stockée en mémoire flash dans la copie en RAM de l'afficheur
+ * @details    Equivalent de LCD_BufferPrintString() pour une chaine en mémoire flash
+ *
+ * Exemple :
+ * @code
+ * LCD_BufferPrintString_P(1, 0, PSTR("Menu"));
+ * @endcode
+ */
+void LCD_BufferPrintString_P(const uint8_t line, const uint8_t column, const char * string);
+
+/**
+ * @brief      Copie un écran complet stocké en mémoire flash dans la copie en RAM de l'afficheur
+ * @details    Equivalent de LCD_PrintScreen_P() pour la copie en RAM : lors du changement
+ *             d'écran, seuls les caractères qui diffèrent de l'écran précédent sont envoyés
+ *             au prochain LCD_Flush().
+ *
+ * @param      [in]      screen    Modèle d'écran en mémoire flash (voir LCD_PrintScreen_P())
+ *
+ * Exemple :
+ * @code
+ * LCD_BufferPrintScreen_P(screen_temp);
+ * LCD_BufferPrintInt(0, 7, temperature, 4, LCD_FILL_SPACE);
+ * LCD_Flush();
+ * @endcode
+ */
+void LCD_BufferPrintScreen_P(const char * screen);
+
+/**
+ * @brief      Ecrit un entier non signé dans la copie en RAM de l'afficheur
+ * @details    Equivalent de LCD_PrintUInt() pour la copie en RAM
+ *
+ * Exemple :
+ * @code
+ * LCD_BufferPrintUInt(0, 6, temperature, 3, LCD_FILL_SPACE);
+ * @endcode
+ */
+void LCD_BufferPrintUInt(const uint8_t line, const uint8_t column, const uint16_t value, const uint8_t width, const LCD_FILL fill);
+
+/**
+ * @brief      Ecrit un entier signé dans la copie en RAM de l'afficheur
+ * @details    Equivalent de LCD_PrintInt() pour la copie en RAM
+ */
+void LCD_BufferPrintInt(const uint8_t line, const uint8_t column, const int16_t value, const uint8_t width, const LCD_FILL fill);
+
+/**
+ * @brief      Ecrit un nombre à virgule fixe dans la copie en RAM de l'afficheur
+ * @details    Equivalent de LCD_PrintFixed() pour la copie en RAM
+ *
+ * Exemple :
+ * @code
+ * LCD_BufferPrintFixed(1, 0, tension_mv, 3, 6, LCD_FILL_SPACE);
+ * @endcode
+ */
+void LCD_BufferPrintFixed(const uint8_t line, const uint8_t column, const int16_t value, const uint8_t decimals, const uint8_t width, const LCD_FILL fill);
+
+/**
+ * @brief      Ecrit un entier en hexadécimal dans la copie en RAM de l'afficheur
+ * @details    Equivalent de LCD_PrintHex() pour la copie en RAM
+ */
+void LCD_BufferPrintHex(const uint8_t line, const uint8_t column, const uint16_t value, const uint8_t width, const LCD_FILL fill);
+
+/**
+ * @brief      Envoie les modifications de la copie en RAM à l'afficheur
+ * @details    Seuls les caractères modifiés depuis le dernier envoi sont écrits. Une commande
+ *             de positionnement n'est envoyée qu'au début de chaque suite de caractères
+ *             modifiés contigus.
+ *
+ * @note       Le curseur est laissé après le dernier caractère écrit.
+ * @note       Le mode d'insertion doit être incrémental (LCD_CURSOR_DIR_INCREMENT) et sans
+ *             décalage de l'affichage.
+ *
+ * Exemple :
+ * @code
+ * LCD_BufferPrintString(0, 7, "22");
+ * LCD_Flush();
+ * @endcode
+ */
+void LCD_Flush(void);
+
+#endif
+
+#if defined(LCD_GLYPH_CACHE)
+
+/**
+ * @brief     Valeur retournée par LCD_GlyphGet() lorsqu'aucune adresse CGRAM n'est disponible
+ */
+#define LCD_GLYPH_NONE            0xFF
+
+/**
+ * @brief      Donne le code d'un caractère custom, enregistré en CGRAM si besoin
+ * @details    Fonction permettant d'utiliser plus de 8 caractères custom au cours du temps.
+ *             Le caractère est identifié par l'adresse de sa définition en mémoire flash. S'il
+ *             est déjà enregistré en CGRAM, son code est retourné sans aucun échange avec
+ *             l'afficheur. Sinon, il est enregistré à la place du caractère le moins récemment
+ *             utilisé qui n'est pas affiché.
+ *
+ * @param      [in]       glyph           Tableau de 8 octets stocké en mémoire flash contenant la
+ *                                        représentation du caractère
+ *
+ * @return     Code du caractère (0 à 7) à passer à LCD_PrintChar() ou LCD_BufferSetChar(),
+ *             LCD_GLYPH_NONE si les 8 adresses CGRAM sont affichées
+ *
+ * @note       Le curseur est replacé à sa position en DDRAM après l'enregistrement
+ * @warning    Une adresse CGRAM enregistrée par LCD_RegisterCharacter() ou
+ *             LCD_RegisterCharacter_P() n'est pas protégée : elle peut être réutilisée par le cache.
+ *
+ * Exemple :
+ * @code
+ * const uint8_t degree[] PROGMEM = { 0x0C, 0x12, 0x12, 0x0C, 0x00, 0x00, 0x00, 0x00 };
+ *
+ * LCD_BufferSetChar(0, 9, LCD_GlyphGet(degree));
+ * LCD_Flush();
+ * @endcode
+ */
+uint8_t LCD_GlyphGet(const uint8_t glyph[]);
+
+/**
+ * @brief      Vide le cache des caractères custom
+ * @details    A appeler si la CGRAM a été modifiée sans passer par le driver. Les caractères
+ *             seront enregistrés de nouveau à leur prochaine utilisation.
+ */
+void LCD_GlyphReset(void);
+
+#endif
+
+#if defined(LCD_GRAPHICS)
+
+/**
+ * @brief     Nombre de colonnes d'un grand chiffre
+ */
+#define LCD_BIG_WIDTH             3
+
+/**
+ * @brief     Valeur de LCD_DrawBigDigit() affichant un signe moins
+ */
+#define LCD_BIG_MINUS             10
+
+/**
+ * @brief     Valeur de LCD_DrawBigDigit() effaçant un grand chiffre
+ */
+#define LCD_BIG_BLANK             11
+
+/**
+ * @brief      Affiche une barre horizontale
+ * @details    Fonction disponible uniquement avec LCD_GRAPHICS. Chaque caractère de la barre
+ *             comporte 5 colonnes de points : la barre est remplie de value colonnes de points
+ *             à partir de la gauche, le reste étant effacé. Seuls les caractères qui diffèrent
+ *             de la copie en RAM sont envoyés.
+ *
+ * @param      [in]      line         Numéro de ligne (indice de base 0)
+ * @param      [in]      column       Numéro de colonne du premier caractère (indice de base 0)
+ * @param      [in]      width        Largeur de la barre en caractères
+ * @param      [in]      value        Nombre de colonnes de points remplies (0 à 5 * width)
+ *
+ * Exemple pour afficher un niveau de 0 à 100 % sur 16 caractères :
+ * @code
+ * LCD_DrawBar(1, 0, 16, (uint16_t)niveau * 80 / 100);
+ * @endcode
+ */
+void LCD_DrawBar(const uint8_t line, const uint8_t column, const uint8_t width, const uint8_t value);
+
+/**
+ * @brief      Affiche un grand chiffre sur les 2 lignes
+ * @details    Fonction disponible uniquement avec LCD_GRAPHICS. Le chiffre occupe
+ *             LCD_BIG_WIDTH colonnes sur les 2 lignes. Seuls les caractères qui diffèrent de la
+ *             copie en RAM sont envoyés.
+ *
+ * @param      [in]      column       Numéro de la première colonne (indice de base 0)
+ * @param      [in]      digit        Chiffre (0 à 9), LCD_BIG_MINUS ou LCD_BIG_BLANK
+ *
+ * Exemple :
+ * @code
+ * LCD_DrawBigDigit(0, 7);
+ * @endcode
+ */
+void LCD_DrawBigDigit(const uint8_t column, const uint8_t digit);
+
+/**
+ * @brief      Affiche un nombre en grands chiffres sur les 2 lignes
+ * @details    Fonction disponible uniquement avec LCD_GRAPHICS. Chaque chiffre (ou le signe)
+ *             occupe LCD_BIG_WIDTH colonnes suivies d'une colonne d'espacement. Seuls les
+ *             caractères des chiffres modifiés sont envoyés.
+ *
+ * @param      [in]      column       Numéro de la première colonne (indice de base 0)
+ * @param      [in]      value        Nombre à afficher
+ * @param      [in]      width        Nombre minimal de chiffres, signe compris (alignement à
+ *                                    droite, complété par des chiffres effacés)
+ *
+ * Exemple pour afficher un compteur de 0 à 9999 sur les 16 colonnes :
+ * @code
+ * LCD_DrawBigNumber(0, compteur, 4);
+ * @endcode
+ */
+void LCD_DrawBigNumber(const uint8_t column, const int16_t value, const uint8_t width);
+
+/**
+ * @brief      Affiche une barre horizontale dans la copie en RAM de l'afficheur
+ * @details    Equivalent de LCD_DrawBar() pour la copie en RAM : seuls les caractères dont
+ *             le remplissage a changé seront envoyés au prochain LCD_Flush().
+ *
+ * Exemple de rafraichissement d'un vumètre :
+ * @code
+ * LCD_BufferDrawBar(0, 0, 16, gauche);
+ * LCD_BufferDrawBar(1, 0, 16, droite);
+ * LCD_Flush();
+ * @endcode
+ */
+void LCD_BufferDrawBar(const uint8_t line, const uint8_t column, const uint8_t width, const uint8_t value);
+
+/**
+ * @brief      Affiche un grand chiffre dans la copie en RAM de l'afficheur
+ * @details    Equivalent de LCD_DrawBigDigit() pour la copie en RAM
+ */
+void LCD_BufferDrawBigDigit(const uint8_t column, const uint8_t digit);
+
+/**
+ * @brief      Affiche un nombre en grands chiffres dans la copie en RAM de l'afficheur
+ * @details    Equivalent de LCD_DrawBigNumber() pour la copie en RAM : seuls les caractères
+ *             des chiffres modifiés seront envoyés au prochain LCD_Flush().
+ */
+void LCD_BufferDrawBigNumber(const uint8_t column, const int16_t value, const uint8_t width);
+
+#endif
+
+#if defined(LCD_STREAM)
+
+/**
+ * @brief      Ecrit un caractère dans le flux stdio de l'afficheur
+ * @details    Fonction d'écriture à passer à fdev_setup_stream() ou FDEV_SETUP_STREAM().
+ *             Les caractères sont mis en attente puis envoyés en une seule rafale. Les
+ *             caractères de contrôle suivants sont interprétés :
+ *             - '\n' : envoi des caractères en attente puis début de la ligne suivante
+ *             - '\r' : envoi des caractères en attente puis début de la ligne courante
+ *             - '\f' : effacement de l'afficheur et retour en première ligne, première colonne
+ *
+ * @param      [in]      character    Caractère à écrire
+ * @param      [in]      stream       Flux stdio (non utilisé)
+ *
+ * @return     Toujours 0
+ *
+ * @note       Le flux démarre en première ligne, première colonne et suit sa propre position,
+ *             indépendamment des autres fonctions d'écriture. Les caractères au-delà de la fin
+ *             de la ligne (colonne 39) sont ignorés.
+ *
+ * Exemple :
+ * @code
+ * FILE lcd;
+ *
+ * fdev_setup_stream(&lcd, LCD_StreamPut, NULL, _FDEV_SETUP_WRITE);
+ * fputs("Hello World\n", &lcd);
+ * @endcode
+ */
+int LCD_StreamPut(char character, FILE * stream);
+
+/**
+ * @brief      Envoie à l'afficheur les caractères en attente du flux stdio
+ * @details    fflush() étant sans effet avec avr-libc, cette fonction est à appeler après une
+ *             écriture qui ne se termine pas par '\n' ou '\r'.
+ *
+ * Exemple :
+ * @code
+ * fprintf(&lcd, "\r%5u", compteur);
+ * LCD_StreamFlush();
+ * @endcode
+ */
+void LCD_StreamFlush(void);
+
+#endif
+
+#if defined(LCD_TRANSPORT_PCF8574)
+
+/**
+ * @brief      Allume ou éteint le rétroéclairage
+ * @details    Fonction disponible uniquement avec LCD_TRANSPORT_PCF8574
+ *
+ * @param      [in]      on           0 pour éteindre le rétroéclairage, allumé sinon
+ *
+ * Exemple :
+ * @code
+ * LCD_SetBacklight(0);
+ * @endcode
+ */
+void LCD_SetBacklight(const uint8_t on);
+
+#endif
+
+#if defined(LCD_ASYNC)
+
+/**
+ * @brief      Traite la file d'attente du mode asynchrone
+ * @details    Envoie l'entrée suivante de la file à l'afficheur lorsque l'instruction
+ *             précédente est terminée. Fonction à appeler toutes les LCD_ASYNC_TICK_US µs
+ *             depuis une interruption timer (inutile si LCD_ASYNC_TIMER_vect est définie).
+ *
+ * Exemple :
+ * @code
+ * ISR(TIMER2_COMPA_vect)
+ * {
+ *     LCD_AsyncTick();
+ *     // Autres traitements périodiques...
+ * }
+ * @endcode
+ */
+void LCD_AsyncTick(void);
+
+/**
+ * @brief      Indique si des instructions sont en attente ou en cours d'exécution
+ * @details    Toutes les files d'attente sont prises en compte si LCD_DISPLAY_COUNT est
+ *             supérieure à 1.
+ *
+ * @return     Valeur indiquant l'état de la file d'attente
+ *
+ * @retval     0x00   Toutes les instructions ont été exécutées
+ * @retval     0x01   Des instructions sont en attente ou en cours d'exécution
+ */
+uint8_t LCD_AsyncIsBusy(void);
+
+/**
+ * @brief      Initialise l'afficheur LCD sans attendre la fin de sa mise sous tension
+ * @details    Equivalent asynchrone de LCD_Initialize() : la séquence de mise sous tension
+ *             (LCD_POWER_ON_MS ms, puis séquence d'initialisation par instructions avec les
+ *             temporisations de la datasheet en interface 4 bits) est placée dans la file
+ *             d'attente et exécutée par LCD_AsyncTick(). La fonction rend la main immédiatement :
+ *             le firmware poursuit son initialisation pendant celle de l'afficheur, et les
+ *             fonctions d'écriture peuvent être appelées aussitôt (leurs instructions sont
+ *             exécutées à la suite).
+ *
+ * @note       A appeler à la place de LCD_Initialize() (pour chaque afficheur si
+ *             LCD_DISPLAY_COUNT est supérieure à 1), les interruptions actives.
+ * @note       La séquence occupe au moins 12 entrées de la file d'attente : si
+ *             LCD_ASYNC_QUEUE_SIZE est plus petite, la fonction attend que des places se
+ *             libèrent.
+ *
+ * Exemple :
+ * @code
+ * sei();
+ * LCD_InitializeAsync();
+ * LCD_PrintString_P(PSTR("Version 1.2"));
+ * @endcode
+ */
+void LCD_InitializeAsync(void);
+
+#if defined(LCD_MARQUEE)
+
+/**
+ * @brief      Fait défiler un texte sur une ligne
+ * @details    Fonction disponible uniquement avec LCD_MARQUEE. Le texte est affiché dans les
+ *             colonnes visibles de la ligne et, s'il est plus long, décalé d'un caractère toutes
+ *             les period_ms ms puis répété après LCD_MARQUEE_GAP espaces. Le défilement est
+ *             réalisé par LCD_AsyncTick() et la fonction rend la main immédiatement.
+ *
+ * @param      [in]      line         Numéro de ligne (indice de base 0)
+ * @param      [in]      text         Texte à faire défiler
+ * @param      [in]      period_ms    Durée d'affichage de chaque position (en ms)
+ *
+ * @warning    Le texte n'est pas copié : il doit rester valide jusqu'à LCD_MarqueeStop().
+ * @warning    Les autres fonctions d'écriture ne doivent pas écrire sur la ligne tant que le
+ *             texte défile. Le mode d'insertion doit être incrémental et sans décalage de
+ *             l'affichage.
+ *
+ * Exemple :
+ * @code
+ * static char message[64];
+ *
+ * LCD_MarqueeStart(1, message, 300);
+ * @endcode
+ */
+void LCD_MarqueeStart(const uint8_t line, const char * text, const uint16_t period_ms);
+
+/**
+ * @brief      Fait défiler un texte stocké en mémoire flash sur une ligne
+ * @details    Identique à LCD_MarqueeStart(), le texte étant en mémoire flash.
+ *
+ * Exemple :
+ * @code
+ * LCD_MarqueeStart_P(0, PSTR("Bienvenue - appuyez sur une touche pour commencer"), 250);
+ * @endcode
+ */
+void LCD_MarqueeStart_P(const uint8_t line, const char * text, const uint16_t period_ms);
+
+/**
+ * @brief      Arrête le défilement d'une ligne
+ * @details    La dernière position affichée reste à l'écran et la ligne peut de nouveau être
+ *             écrite par les autres fonctions.
+ *
+ * @param      [in]      line         Numéro de ligne (indice de base 0)
+ */
+void LCD_MarqueeStop(const uint8_t line);
+
+#endif
+
+/**
+ * @brief      Attend l'exécution de toutes les instructions des files d'attente
+ *
+ * @warning    Les interruptions doivent être actives.
+ */
+void LCD_AsyncWait(void);
+
+#endif
+
 #include <LCD/Displaytech/162c_core.h>
 
 #endif /* _162C_H_ */
@@ -16,6 +16,21 @@
 
 #include <util/delay.h>
 #include <avr/pgmspace.h>
+#if defined(LCD_GLYPH_CACHE)
+#  include <stddef.h>
+#endif
+#if defined(LCD_STREAM)
+#  include <stdio.h>
+#endif
+#if defined(LCD_ASYNC_TIMER_vect)
+#  include <avr/interrupt.h>
+#endif
+#if defined(LCD_MARQUEE)
+#  include <util/atomic.h>
+#endif
+#if defined(LCD_READBACK)
+#  include <string.h>
+#endif
 
 // Liste des commandes
 #define LCD_CMD_CLEAR             0x01
@@ -45,217 +60,1914 @@
 // Masque définissant si l'afficheur LCD est occupée ou non
 #define LCD_MSK_BUSY_FLG          0x80
 
+// Nombre maximal de lectures du busy flag (plus de 2 ms) avant de considérer l'afficheur prêt
+#define LCD_BUSY_TIMEOUT          1000
+
+// Valeur d'interface de la commande LCD_CMD_FUNC
+#if defined(LCD_INTERFACE_4BITS)
+#  define LCD_FUNC_INTF           0
+#else
+#  define LCD_FUNC_INTF           (1 << LCD_BIT_FUNC_INTF)
+#endif
+
 // Offset permettant de passer d'une ligne à l'autre
 #define LCD_OFFSET_LINE           0x40
 
-static void Strobe(void)
+// Taille d'un nombre formaté (largeur maximale et zéro binaire)
+#define LCD_NUMBER_SIZE           17
+
+// Type d'un octet envoyé à l'afficheur
+#define LCD_SEND_COMMAND          0x00  // Commande (RS off), exécutée en 42 µs
+#define LCD_SEND_DATA             0x01  // Caractère (RS on), exécuté en 46 µs
+#define LCD_SEND_LONG             0x02  // Commande exécutée en 1,64 ms (clear, home)
+#define LCD_SEND_INIT             0x04  // Commande de synchronisation (LCD_BusWriteInit())
+#define LCD_SEND_DELAY            0x08  // Pas d'écriture : attente d'un nombre de ticks (LCD_ASYNC)
+
+#if defined(LCD_ASYNC)
+// Masque de rebouclage des index de la file d'attente
+#  define LCD_ASYNC_QUEUE_MASK    (LCD_ASYNC_QUEUE_SIZE - 1)
+
+// Nombre de ticks couvrant une durée d'exécution (en µs)
+#  define LCD_ASYNC_TICKS(us)     (((us) + LCD_ASYNC_TICK_US - 1) / LCD_ASYNC_TICK_US)
+
+#  if LCD_ASYNC_TICKS(1640) > 255
+#    error "LCD_ASYNC_TICK_US est trop petit (1,64 ms doit tenir sur 255 ticks)"
+#  endif
+
+/**
+ * @brief     Entrée de la file d'attente
+ */
+typedef struct
+{
+  uint8_t value;                  /**< Commande ou caractère */
+  uint8_t flags;                  /**< Combinaison de LCD_SEND_xxx */
+} LCD_ASYNC_ENTRY;
+#endif
+
+#if defined(LCD_MARQUEE)
+/**
+ * @brief     Texte défilant d'une ligne
+ */
+typedef struct
+{
+  const char * text;              /**< Texte (en RAM ou en mémoire flash) */
+  uint8_t flash;                  /**< Non nul si le texte est en mémoire flash */
+  uint8_t length;                 /**< Nombre de caractères du texte */
+  uint8_t position;               /**< Index du caractère affiché en première colonne */
+  uint8_t due;                    /**< Non nul si la fenêtre doit être réécrite */
+  uint16_t period;                /**< Nombre de ticks entre deux décalages, 0 si la ligne est libre */
+  uint16_t count;                 /**< Nombre de ticks restants avant le prochain décalage */
+} LCD_MARQUEE_LINE;
+
+/**
+ * @brief     Ecriture en cours d'une fenêtre de texte défilant
+ */
+typedef struct
+{
+  uint8_t active;                 /**< Non nul pendant l'écriture de la fenêtre */
+  uint8_t line;                   /**< Ligne écrite */
+  uint8_t column;                 /**< Colonne visible du prochain caractère */
+  uint8_t index;                  /**< Index du prochain caractère dans le texte */
+  uint8_t address;                /**< Non nul si une commande de positionnement doit précéder
+                                       le prochain caractère */
+  uint8_t origin;                 /**< Décalage de l'affichage (première colonne visible) */
+  uint8_t cursor;                 /**< Compteur d'adresse à restaurer en fin d'écriture */
+  const char * text;              /**< Copie du texte de la ligne */
+  uint8_t flash;                  /**< Copie de l'indicateur mémoire flash */
+  uint8_t length;                 /**< Copie du nombre de caractères */
+} LCD_MARQUEE_DRAW;
+
+// Longueur du texte suivie d'espaces avant sa répétition
+#  define LCD_MARQUEE_CYCLE(m)    ((m)->length + LCD_MARQUEE_GAP)
+
+// Empêche le début d'une nouvelle écriture pendant un accès direct au bus
+static volatile uint8_t LCD_marquee_hold;
+#endif
+
+#if defined(LCD_READBACK)
+// Nombre de caractères lus avant l'écriture de ceux qui diffèrent
+#  define LCD_UPDATE_CHUNK        8
+#endif
+
+#if defined(LCD_BUFFER)
+// Nombre de caractères de la mémoire d'affichage
+#  define LCD_BUFFER_SIZE         (LCD_LINE_COUNT * LCD_LINE_LENGTH)
+#endif
+
+#if defined(LCD_GRAPHICS)
+// Jeux de caractères des barres et des grands chiffres, enregistrés en CGRAM à la première utilisation
+#  define LCD_CHARSET_BAR         0x01  // Barres remplies de 1 à 4 colonnes, adresses 0 à 3
+#  define LCD_CHARSET_BIG         0x02  // Segments des grands chiffres, adresses 4 à 6
+
+#  define LCD_CGRAM_BAR           LCD_CGRAM_00
+#  define LCD_CGRAM_BIG           LCD_CGRAM_04
+
+// Caractère plein de la ROM de l'afficheur
+#  define LCD_CHAR_BLOCK          0xFF
+#endif
+
+/**
+ * @brief     Etat d'un afficheur suivi par le driver
+ * @details   Mis à jour à chaque envoi, sans aucune lecture de l'afficheur
+ */
+typedef struct
+{
+  uint8_t address;                /**< Commande de positionnement équivalente au compteur d'adresse
+                                       (LCD_CMD_SET_DDRAM ou LCD_CMD_SET_CGRAM | adresse) */
+  uint8_t shift;                  /**< Décalage de l'affichage (0 à LCD_LINE_LENGTH - 1) */
+  uint8_t entry;                  /**< Dernière commande LCD_CMD_ENTRY */
+#if defined(LCD_READBACK)
+  uint8_t latched;                /**< Non nul si le registre de lecture de l'afficheur contient
+                                       l'octet à l'adresse courante (après un positionnement ou
+                                       une lecture) */
+#endif
+#if defined(LCD_ASYNC)
+  volatile LCD_ASYNC_ENTRY queue[LCD_ASYNC_QUEUE_SIZE]; /**< File d'attente circulaire : remplie par
+                                                             LCD_Send(), vidée par LCD_AsyncTick().
+                                                             Volatile pour que ses accès restent
+                                                             ordonnés avec ceux de head et tail */
+  volatile uint8_t head;          /**< Index d'écriture de la file d'attente */
+  volatile uint8_t tail;          /**< Index de lecture de la file d'attente */
+  volatile uint8_t wait;          /**< Nombre de ticks restants avant la fin de l'instruction en
+                                       cours (avec le busy flag : non nul tant que la fin de
+                                       l'instruction n'a pas été constatée) */
+  volatile uint8_t delay;         /**< Nombre de ticks restants d'une temporisation de la
+                                       séquence de mise sous tension */
+#endif
+#if defined(LCD_BUFFER)
+  uint8_t buffer[LCD_BUFFER_SIZE];          /**< Copie en RAM de la mémoire d'affichage */
+  uint8_t dirty[(LCD_BUFFER_SIZE + 7) / 8]; /**< Un bit par caractère : positionné si le
+                                                 caractère doit être envoyé à l'afficheur */
+#endif
+#if defined(LCD_GLYPH_CACHE)
+  const uint8_t * glyph_tag[8];   /**< Caractère (en mémoire flash) enregistré dans chaque
+                                       adresse CGRAM, NULL si aucun */
+  uint8_t glyph_rank[8];          /**< Rang d'utilisation de chaque adresse CGRAM : 0 pour la plus
+                                       récente, 7 pour la plus ancienne */
+#endif
+#if defined(LCD_STREAM)
+  char stream_buffer[LCD_STREAM_SIZE]; /**< Caractères écrits par le flux et pas encore envoyés */
+  uint8_t stream_count;           /**< Nombre de caractères en attente */
+  uint8_t stream_line;            /**< Ligne du premier caractère en attente */
+  uint8_t stream_column;          /**< Colonne du premier caractère en attente */
+#endif
+#if defined(LCD_GRAPHICS)
+  uint8_t charsets;               /**< Jeux de caractères LCD_CHARSET_xxx présents en CGRAM */
+#endif
+#if defined(LCD_MARQUEE)
+  LCD_MARQUEE_LINE marquee[LCD_LINE_COUNT]; /**< Texte défilant de chaque ligne */
+  LCD_MARQUEE_DRAW draw;          /**< Ecriture en cours d'une fenêtre */
+#endif
+} LCD_DISPLAY;
+
+static LCD_DISPLAY LCD_displays[LCD_DISPLAY_COUNT];
+
+// Afficheur sélectionné, auquel s'appliquent toutes les fonctions
+static LCD_DISPLAY * LCD_display = LCD_displays;
+#if LCD_DISPLAY_COUNT > 1
+static uint8_t LCD_selected;
+#endif
+
+// Transport : fonctions LCD_Busxxx
+#if defined(LCD_TRANSPORT_PCF8574)
+#  include <LCD/Displaytech/162c_pcf8574.h>
+#elif defined(LCD_TRANSPORT_PINMAP)
+#  include <LCD/Displaytech/162c_pinmap.h>
+#else
+#  include <LCD/Displaytech/162c_parallel.h>
+#endif
+
+// Regroupement des écritures successives (sans objet en mode asynchrone)
+#if defined(LCD_ASYNC)
+#  define LCD_SendBegin()
+#  define LCD_SendEnd()
+#else
+#  define LCD_SendBegin()         LCD_BusBegin()
+#  define LCD_SendEnd()           LCD_BusEnd()
+#endif
+
+/**
+ * @brief     Synchronise l'interface de l'afficheur
+ * @details   Séquence d'initialisation par instructions de la datasheet : trois commandes
+ *            "function set 8 bits" ramènent l'afficheur en mode 8 bits quel que soit son
+ *            état (y compris au milieu d'un octet en mode 4 bits), puis le mode 4 bits est
+ *            sélectionné si besoin. Le busy flag n'est pas lisible pendant cette séquence.
+ */
+static void LCD_Synchronize(void)
+{
+	LCD_BusWriteInit(0b00110000);
+	_delay_ms(4.1);
+	LCD_BusWriteInit(0b00110000);
+	_delay_us(100);
+	LCD_BusWriteInit(0b00110000);
+	_delay_us(42);
+#if defined(LCD_INTERFACE_4BITS)
+	LCD_BusWriteInit(0b00100000);
+	_delay_us(42);
+#endif
+}
+
+/**
+ * @brief     Ecrit un octet sur le bus et attend la fin de son exécution
+ * @details   Avec le busy flag, l'attente a lieu avant l'écriture suivante et se termine
+ *            dès que l'afficheur est prêt. Sans busy flag, la durée d'exécution maximale
+ *            de l'instruction est attendue après l'écriture.
+ */
+static void LCD_Execute(const uint8_t value, const uint8_t flags)
+{
+#if defined(LCD_HAS_BUSY_FLAG)
+	LCD_BusWaitReady(LCD_BUSY_TIMEOUT);
+	LCD_BusWrite(value, flags);
+#else
+	LCD_BusWrite(value, flags);
+
+	if (flags & LCD_SEND_LONG)
+	{
+		_delay_ms(1.64);
+	}
+#  if !defined(LCD_BUS_SELF_TIMED)
+	else if (flags & LCD_SEND_DATA)
+	{
+		_delay_us(46);
+	}
+	else
+	{
+		_delay_us(42);
+	}
+#  elif defined(LCD_BUS_DATA_DELAY_US)
+	else if (flags & LCD_SEND_DATA)
+	{
+		// Durée de l'écriture inférieure au temps d'exécution d'une donnée
+		_delay_us(LCD_BUS_DATA_DELAY_US);
+	}
+#  endif
+#endif
+}
+
+/**
+ * @brief     Adresse suivante (ou précédente) du compteur d'adresse
+ * @details   En DDRAM, les deux lignes forment un anneau de 80 caractères :
+ *            0x27 est suivie de 0x40 et 0x67 de 0x00.
+ *
+ * @param     [in]    address   Commande de positionnement courante
+ * @param     [in]    increment Non nul pour avancer, nul pour reculer
+ */
+static uint8_t LCD_StepAddress(const uint8_t address, const uint8_t increment)
+{
+	uint8_t ddram = address & ~LCD_CMD_SET_DDRAM;
+
+	if (!(address & LCD_CMD_SET_DDRAM))
+	{
+		return LCD_CMD_SET_CGRAM | ((address + (increment ? 1 : -1)) & 0x3F);
+	}
+
+	if (increment)
+	{
+		ddram++;
+		if (ddram == LCD_LINE_LENGTH)
+		{
+			ddram = LCD_OFFSET_LINE;
+		}
+		else if (ddram == LCD_OFFSET_LINE + LCD_LINE_LENGTH)
+		{
+			ddram = 0x00;
+		}
+	}
+	else
+	{
+		if (ddram == 0x00)
+		{
+			ddram = LCD_OFFSET_LINE + LCD_LINE_LENGTH - 1;
+		}
+		else if (ddram == LCD_OFFSET_LINE)
+		{
+			ddram = LCD_LINE_LENGTH - 1;
+		}
+		else
+		{
+			ddram--;
+		}
+	}
+
+	return LCD_CMD_SET_DDRAM | ddram;
+}
+
+/**
+ * @brief     Met à jour l'état suivi de l'afficheur pour un octet envoyé
+ */
+static void LCD_Track(const uint8_t value, const uint8_t flags)
+{
+	uint8_t increment = LCD_display->entry & _BV(LCD_BIT_ENTRY_INC);
+
+#if defined(LCD_READBACK)
+	// Seul un positionnement recharge le registre de lecture
+	LCD_display->latched = 0;
+#endif
+
+	if (flags & LCD_SEND_DATA)
+	{
+		if ((LCD_display->entry & _BV(LCD_BIT_ENTRY_SHIFT)) && (LCD_display->address & LCD_CMD_SET_DDRAM))
+		{
+			// L'affichage suit le curseur
+			LCD_display->shift = (LCD_display->shift + (increment ? 1 : LCD_LINE_LENGTH - 1)) % LCD_LINE_LENGTH;
+		}
+		LCD_display->address = LCD_StepAddress(LCD_display->address, increment);
+	}
+	else if (value & (LCD_CMD_SET_DDRAM | LCD_CMD_SET_CGRAM))
+	{
+		LCD_display->address = value;
+#if defined(LCD_READBACK)
+		LCD_display->latched = 1;
+#endif
+	}
+	else if (value & LCD_CMD_FUNC)
+	{
+	}
+	else if (value & LCD_CMD_SHIFT)
+	{
+		uint8_t right = value & _BV(LCD_BIT_SHIFT_DIR);
+
+		if (value & _BV(LCD_BIT_SHIFT_TYPE))
+		{
+			LCD_display->shift = (LCD_display->shift + (right ? LCD_LINE_LENGTH - 1 : 1)) % LCD_LINE_LENGTH;
+		}
+		else
+		{
+			LCD_display->address = LCD_StepAddress(LCD_display->address, right);
+		}
+	}
+	else if (value & LCD_CMD_DISP)
+	{
+	}
+	else if (value & LCD_CMD_ENTRY)
+	{
+		LCD_display->entry = value;
+	}
+	else if (value & (LCD_CMD_HOME | LCD_CMD_CLEAR))
+	{
+		LCD_display->address = LCD_CMD_SET_DDRAM;
+		LCD_display->shift   = 0;
+		if (value & LCD_CMD_CLEAR)
+		{
+			// L'effacement repasse en mode incrémental
+			LCD_display->entry |= _BV(LCD_BIT_ENTRY_INC);
+		}
+	}
+}
+
+#if defined(LCD_ASYNC)
+
+/**
+ * @brief     Ajoute une entrée à la file d'attente, sans mise à jour de l'état suivi
+ * @details   Si la file est pleine, la fonction attend que l'interruption libère une place.
+ */
+static void LCD_AsyncPush(const uint8_t value, const uint8_t flags)
+{
+	uint8_t head = LCD_display->head;
+	uint8_t next = (head + 1) & LCD_ASYNC_QUEUE_MASK;
+
+	while (next == LCD_display->tail);
+
+	LCD_display->queue[head].value = value;
+	LCD_display->queue[head].flags = flags;
+	// L'entrée n'est visible par l'interruption qu'une fois complète (queue et head sont volatiles :
+	// le compilateur ne peut pas déplacer l'écriture de l'entrée après celle de head)
+	LCD_display->head = next;
+}
+
+/**
+ * @brief     Envoie un octet à l'afficheur
+ * @details   L'octet est ajouté à la file d'attente. Si la file est pleine, la fonction
+ *            attend que l'interruption libère une place.
+ */
+static void LCD_Send(const uint8_t value, const uint8_t flags)
+{
+	LCD_AsyncPush(value, flags);
+
+	// Etat suivi mis à jour après l'ajout : file vide, il correspond à celui de l'afficheur
+	LCD_Track(value, flags);
+}
+
+/**
+ * @brief     Ajoute une temporisation à la file d'attente
+ *
+ * @param     [in]    ticks     Durée en ticks de LCD_ASYNC_TICK_US µs
+ */
+static void LCD_AsyncDelay(uint16_t ticks)
+{
+	while (ticks)
+	{
+		uint8_t step = ticks > 255 ? 255 : ticks;
+
+		LCD_AsyncPush(step, LCD_SEND_DELAY);
+		ticks -= step;
+	}
+}
+
+/**
+ * @brief     Ecrit un octet sur le bus et démarre l'attente de la fin de son exécution
+ */
+static void LCD_AsyncWrite(LCD_DISPLAY * display, const uint8_t value, const uint8_t flags)
+{
+	if (flags & LCD_SEND_DELAY)
+	{
+		display->delay = value;
+		return;
+	}
+	if (flags & LCD_SEND_INIT)
+	{
+		// Busy flag illisible : la durée d'exécution est couverte par la temporisation suivante
+		LCD_BusWriteInit(value);
+		return;
+	}
+
+	LCD_BusWrite(value, flags);
+
+#if defined(LCD_HAS_BUSY_FLAG)
+	// La fin de l'instruction sera détectée par le busy flag
+	display->wait = 1;
+#else
+	if (flags & LCD_SEND_LONG)
+	{
+		display->wait = LCD_ASYNC_TICKS(1640);
+	}
+	else if (flags & LCD_SEND_DATA)
+	{
+		display->wait = LCD_ASYNC_TICKS(46);
+	}
+	else
+	{
+		display->wait = LCD_ASYNC_TICKS(42);
+	}
+#endif
+}
+
+#if defined(LCD_MARQUEE)
+
+/**
+ * @brief     Décale les textes défilants d'un afficheur à échéance
+ */
+static void LCD_MarqueeAdvance(LCD_DISPLAY * display)
+{
+	for (uint8_t line = 0; line < LCD_LINE_COUNT; line++)
+	{
+		LCD_MARQUEE_LINE * marquee = &display->marquee[line];
+
+		// Ligne libre ou texte tenant dans la fenêtre : pas de défilement
+		if (!marquee->period || marquee->length <= LCD_DISPLAY_WIDTH || --marquee->count)
+		{
+			continue;
+		}
+
+		marquee->count = marquee->period;
+		if (++marquee->position == LCD_MARQUEE_CYCLE(marquee))
+		{
+			marquee->position = 0;
+		}
+		marquee->due = 1;
+	}
+}
+
+/**
+ * @brief     Ecrit l'octet suivant d'une fenêtre de texte défilant
+ * @details   Une fenêtre n'est commencée que lorsque la file d'attente est vide : le compteur
+ *            d'adresse suivi correspond alors à celui de l'afficheur et il est restauré en fin
+ *            de fenêtre, avant l'exécution des entrées ajoutées entre-temps.
+ *
+ * @return    Non nul si un octet a été écrit
+ */
+static uint8_t LCD_MarqueeDraw(LCD_DISPLAY * display)
+{
+	LCD_MARQUEE_DRAW * draw = &display->draw;
+
+	if (!draw->active)
+	{
+		if (LCD_marquee_hold || display->tail != display->head)
+		{
+			return 0;
+		}
+
+		for (draw->line = 0; draw->line < LCD_LINE_COUNT; draw->line++)
+		{
+			if (display->marquee[draw->line].due)
+			{
+				break;
+			}
+		}
+		if (draw->line == LCD_LINE_COUNT)
+		{
+			return 0;
+		}
+
+		LCD_MARQUEE_LINE * marquee = &display->marquee[draw->line];
+		marquee->due    = 0;
+		draw->active  = 1;
+		draw->column  = 0;
+		draw->index   = marquee->position;
+		draw->address = 1;
+		draw->origin  = display->shift;
+		draw->cursor  = display->address;
+		draw->text    = marquee->text;
+		draw->flash   = marquee->flash;
+		draw->length  = marquee->length;
+	}
+
+	if (draw->column == LCD_DISPLAY_WIDTH)
+	{
+		// Retour du compteur d'adresse à la position du curseur
+		LCD_AsyncWrite(display, draw->cursor, LCD_SEND_COMMAND);
+		draw->active = 0;
+		return 1;
+	}
+
+	uint8_t column = (draw->origin + draw->column) % LCD_LINE_LENGTH;
+
+	if (draw->address)
+	{
+		LCD_AsyncWrite(display, LCD_CMD_SET_DDRAM | (LCD_OFFSET_LINE * draw->line + column), LCD_SEND_COMMAND);
+		draw->address = 0;
+		return 1;
+	}
+
+	char character = ' ';
+
+	if (draw->index < draw->length)
+	{
+		character = draw->flash ? pgm_read_byte(&(draw->text[draw->index])) : draw->text[draw->index];
+	}
+	// Un texte plus long que la fenêtre est répété après LCD_MARQUEE_GAP espaces
+	if (++draw->index == LCD_MARQUEE_CYCLE(draw) && draw->length > LCD_DISPLAY_WIDTH)
+	{
+		draw->index = 0;
+	}
+
+	LCD_AsyncWrite(display, character, LCD_SEND_DATA);
+
+	// Fin de la ligne de la mémoire d'affichage : l'afficheur passe à la ligne suivante
+	if (++column == LCD_LINE_LENGTH)
+	{
+		draw->address = 1;
+	}
+	draw->column++;
+
+	return 1;
+}
+
+#endif
+
+/**
+ * @brief     Traite la file d'attente d'un afficheur
+ */
+static void LCD_AsyncService(LCD_DISPLAY * display)
+{
+#if defined(LCD_MARQUEE)
+	LCD_MarqueeAdvance(display);
+#endif
+
+	// Temporisation de la séquence de mise sous tension
+	if (display->delay && --display->delay)
+	{
+		return;
+	}
+
+	// Instruction précédente toujours en cours d'exécution
+#if defined(LCD_HAS_BUSY_FLAG)
+	if (display->wait)
+	{
+		if (LCD_BusWaitReady(1))
+		{
+			return;
+		}
+		display->wait = 0;
+	}
+#else
+	if (display->wait && --display->wait)
+	{
+		return;
+	}
+#endif
+
+#if defined(LCD_MARQUEE)
+	if (LCD_MarqueeDraw(display))
+	{
+		return;
+	}
+#endif
+
+	uint8_t tail = display->tail;
+
+	if (tail == display->head)
+	{
+		return;
+	}
+
+	// L'entrée est lue avant de libérer sa place dans la file
+	uint8_t value = display->queue[tail].value;
+	uint8_t flags = display->queue[tail].flags;
+	display->tail = (tail + 1) & LCD_ASYNC_QUEUE_MASK;
+
+	LCD_AsyncWrite(display, value, flags);
+}
+
+void LCD_AsyncTick(void)
+{
+#if LCD_DISPLAY_COUNT > 1
+	// Chaque afficheur exécute ses instructions indépendamment des autres
+	for (uint8_t i = 0; i < LCD_DISPLAY_COUNT; i++)
+	{
+		LCD_BusSelect(i);
+		LCD_AsyncService(&LCD_displays[i]);
+	}
+	// Retour à l'afficheur sélectionné par l'application
+	LCD_BusSelect(LCD_selected);
+#else
+	LCD_AsyncService(LCD_displays);
+#endif
+}
+
+uint8_t LCD_AsyncIsBusy(void)
+{
+	for (uint8_t i = 0; i < LCD_DISPLAY_COUNT; i++)
+	{
+		LCD_DISPLAY * display = &LCD_displays[i];
+
+		if (display->head != display->tail || display->wait || display->delay)
+		{
+			return 1;
+		}
+#if defined(LCD_MARQUEE)
+		if (display->draw.active)
+		{
+			return 1;
+		}
+#endif
+	}
+
+	return 0;
+}
+
+void LCD_AsyncWait(void)
+{
+	while (LCD_AsyncIsBusy());
+}
+
+#  if defined(LCD_MARQUEE)
+
+/**
+ * @brief     Demande la réécriture des textes défilants de l'afficheur sélectionné
+ */
+static void LCD_MarqueeRedraw(void)
+{
+	for (uint8_t line = 0; line < LCD_LINE_COUNT; line++)
+	{
+		if (LCD_display->marquee[line].period)
+		{
+			LCD_display->marquee[line].due = 1;
+		}
+	}
+}
+
+/**
+ * @brief     Démarre le défilement d'un texte en RAM ou en mémoire flash
+ */
+static void LCD_MarqueeSet(const uint8_t line, const char * text, const uint8_t flash, const uint16_t period_ms)
+{
+	LCD_MARQUEE_LINE * marquee = &LCD_display->marquee[line];
+	uint8_t length = 0;
+	uint32_t period = (uint32_t)period_ms * 1000 / LCD_ASYNC_TICK_US;
+
+	while (length < 255 - LCD_MARQUEE_GAP && (flash ? pgm_read_byte(&(text[length])) : text[length]))
+	{
+		length++;
+	}
+
+	// L'interruption ne doit pas voir un texte partiellement modifié
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		marquee->text     = text;
+		marquee->flash    = flash;
+		marquee->length   = length;
+		marquee->position = 0;
+		marquee->period   = (period == 0) ? 1 : (period > 0xFFFF) ? 0xFFFF : period;
+		marquee->count    = marquee->period;
+		marquee->due      = 1;
+	}
+}
+
+void LCD_MarqueeStart(const uint8_t line, const char * text, const uint16_t period_ms)
+{
+	LCD_MarqueeSet(line, text, 0, period_ms);
+}
+
+void LCD_MarqueeStart_P(const uint8_t line, const char * text, const uint16_t period_ms)
+{
+	LCD_MarqueeSet(line, text, 1, period_ms);
+}
+
+void LCD_MarqueeStop(const uint8_t line)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		LCD_display->marquee[line].period = 0;
+		LCD_display->marquee[line].due    = 0;
+	}
+}
+
+#  endif
+
+#  if defined(LCD_ASYNC_TIMER_vect)
+ISR(LCD_ASYNC_TIMER_vect)
+{
+	LCD_AsyncTick();
+}
+#  endif
+
+#else
+
+/**
+ * @brief     Envoie un octet à l'afficheur
+ */
+static void LCD_Send(const uint8_t value, const uint8_t flags)
+{
+	LCD_Track(value, flags);
+	LCD_Execute(value, flags);
+}
+
+#endif
+
+static void SendCommand(const uint8_t command)
+{
+	LCD_Send(command, LCD_SEND_COMMAND);
+}
+
+void LCD_PrintChar(const unsigned char character)
+{
+	LCD_Send(character, LCD_SEND_DATA);
+}
+
+void LCD_PrintString(const char * string)
+{
+	LCD_SendBegin();
+	while(*string)
+	{
+		LCD_PrintChar(*string++);
+	}
+	LCD_SendEnd();
+}
+
+void LCD_PrintString_P(const char * string)
+{
+	char character;
+
+	LCD_SendBegin();
+	while ((character = pgm_read_byte(string++)))
+	{
+		LCD_PrintChar(character);
+	}
+	LCD_SendEnd();
+}
+
+void LCD_PrintScreen_P(const char * screen)
+{
+	LCD_SendBegin();
+	for (uint8_t line = 0; line < LCD_LINE_COUNT; line++)
+	{
+		LCD_MoveCursor(line, 0);
+		for (uint8_t column = 0; column < LCD_DISPLAY_WIDTH; column++)
+		{
+			LCD_PrintChar(pgm_read_byte(screen++));
+		}
+	}
+	LCD_SendEnd();
+}
+
+// Puissances de 10 utilisées pour l'extraction des chiffres par soustractions successives
+static const uint16_t LCD_power10[] PROGMEM = { 10000, 1000, 100, 10, 1 };
+
+/**
+ * @brief     Formate un nombre sans division ni printf
+ * @details   Les chiffres décimaux sont extraits par soustractions successives des puissances
+ *            de 10 (au plus 9 soustractions par chiffre), les chiffres hexadécimaux par décalage.
+ *
+ * @param     [out]   text      Chaine formatée (LCD_NUMBER_SIZE caractères)
+ * @param     [in]    value     Valeur absolue du nombre
+ * @param     [in]    negative  Non nul si le nombre est négatif
+ * @param     [in]    decimals  Nombre de chiffres après la virgule
+ * @param     [in]    width     Largeur minimale (alignement à droite)
+ * @param     [in]    fill      Caractère de remplissage
+ * @param     [in]    hex       Non nul pour un affichage en hexadécimal
+ */
+static void LCD_FormatNumber(char text[], uint16_t value, const uint8_t negative, uint8_t decimals,
+                             uint8_t width, const LCD_FILL fill, const uint8_t hex)
+{
+	char digits[5];
+	uint8_t count;
+
+	if (hex)
+	{
+		count = 4;
+		for (uint8_t i = 0; i < count; i++)
+		{
+			uint8_t nibble = (value >> (12 - 4 * i)) & 0x0F;
+			digits[i] = (nibble < 10) ? '0' + nibble : 'A' - 10 + nibble;
+		}
+	}
+	else
+	{
+		count = 5;
+		for (uint8_t i = 0; i < count; i++)
+		{
+			uint16_t power = pgm_read_word(&(LCD_power10[i]));
+			char digit = '0';
+
+			while (value >= power)
+			{
+				value -= power;
+				digit++;
+			}
+			digits[i] = digit;
+		}
+	}
+
+	if (decimals > count - 1)
+	{
+		decimals = count - 1;
+	}
+	if (width > LCD_NUMBER_SIZE - 1)
+	{
+		width = LCD_NUMBER_SIZE - 1;
+	}
+
+	// Suppression des zéros non significatifs (au moins un chiffre avant la virgule)
+	uint8_t start = 0;
+	while (start < count - 1 - decimals && digits[start] == '0')
+	{
+		start++;
+	}
+
+	uint8_t length = count - start + (negative ? 1 : 0) + (decimals ? 1 : 0);
+
+	// Le signe précède les zéros de remplissage et suit les espaces
+	if (negative && fill == LCD_FILL_ZERO)
+	{
+		*text++ = '-';
+	}
+	for (; width > length; width--)
+	{
+		*text++ = fill;
+	}
+	if (negative && fill != LCD_FILL_ZERO)
+	{
+		*text++ = '-';
+	}
+
+	for (uint8_t i = start; i < count; i++)
+	{
+		if (decimals && i == count - decimals)
+		{
+			*text++ = LCD_DECIMAL_POINT;
+		}
+		*text++ = digits[i];
+	}
+	*text = 0;
+}
+
+void LCD_PrintUInt(const uint16_t value, const uint8_t width, const LCD_FILL fill)
+{
+	char text[LCD_NUMBER_SIZE];
+
+	LCD_FormatNumber(text, value, 0, 0, width, fill, 0);
+	LCD_PrintString(text);
+}
+
+void LCD_PrintInt(const int16_t value, const uint8_t width, const LCD_FILL fill)
+{
+	LCD_PrintFixed(value, 0, width, fill);
+}
+
+void LCD_PrintFixed(const int16_t value, const uint8_t decimals, const uint8_t width, const LCD_FILL fill)
+{
+	char text[LCD_NUMBER_SIZE];
+
+	// Valeur absolue calculée en non signé (-32768 inclus)
+	LCD_FormatNumber(text, (value < 0) ? 0U - (uint16_t)value : (uint16_t)value, value < 0, decimals, width, fill, 0);
+	LCD_PrintString(text);
+}
+
+void LCD_PrintHex(const uint16_t value, const uint8_t width, const LCD_FILL fill)
+{
+	char text[LCD_NUMBER_SIZE];
+
+	LCD_FormatNumber(text, value, 0, 0, width, fill, 1);
+	LCD_PrintString(text);
+}
+
+#if LCD_DISPLAY_COUNT > 1
+void LCD_Select(const uint8_t display)
+{
+	LCD_display  = &LCD_displays[display];
+	LCD_selected = display;
+	LCD_BusSelect(display);
+}
+#endif
+
+#if defined(LCD_FAST_INIT)
+
+// Nombre de lectures du busy flag couvrant LCD_POWER_ON_MS (2 µs au moins par lecture)
+#  define LCD_POWER_ON_TRIES      (LCD_POWER_ON_MS * 500U)
+
+/**
+ * @brief     Attend la fin de la mise sous tension de l'afficheur
+ * @details   DB7 est tirée à l'état haut : tant que l'afficheur n'est pas alimenté, le busy flag
+ *            est lu à 1. Un afficheur occupé plus longtemps que la plus longue instruction
+ *            (LCD_BUSY_TIMEOUT lectures, plus de 2 ms) est en cours de réinitialisation interne.
+ *
+ * @return    Non nul si la fin de la réinitialisation interne a été constatée (interface en
+ *            mode 8 bits), nul si l'afficheur était déjà prêt ou ne l'est pas devenu. Un busy
+ *            flag lu à 0 dès le début ne prouve pas que l'afficheur est alimenté (DB7 maintenue
+ *            à l'état bas par un afficheur hors tension) : le résultat nul impose la séquence
+ *            de la datasheet.
+ */
+static uint8_t LCD_PowerOnWait(void)
+{
+	LCD_BusPullUp();
+
+	// Prêt immédiatement ou presque : afficheur déjà alimenté ou DB7 maintenue à l'état bas, interface dans un état inconnu
+	if (!LCD_BusWaitReady(LCD_BUSY_TIMEOUT))
+	{
+		return 0;
+	}
+
+	return !LCD_BusWaitReady(LCD_POWER_ON_TRIES);
+}
+
+#endif
+
+/**
+ * @brief     Place l'afficheur sélectionné dans l'état initial suivi par le driver
+ * @details   Partie commune à LCD_Initialize() et LCD_InitializeAsync(), une fois l'interface
+ *            synchronisée
+ */
+static void LCD_InitializeState(void)
+{
+	// Etat connu du curseur et du décalage de l'affichage, suivi ensuite par le driver
+	LCD_Send(LCD_CMD_ENTRY | _BV(LCD_BIT_ENTRY_INC), LCD_SEND_COMMAND);
+	LCD_Send(LCD_CMD_HOME, LCD_SEND_LONG);
+
+#if defined(LCD_GLYPH_CACHE)
+	// Le contenu de la CGRAM est inconnu
+	LCD_GlyphReset();
+#endif
+
+#if defined(LCD_GRAPHICS)
+	LCD_display->charsets = 0;
+#endif
+
+#if defined(LCD_STREAM)
+	LCD_display->stream_count  = 0;
+	LCD_display->stream_line   = 0;
+	LCD_display->stream_column = 0;
+#endif
+
+#if defined(LCD_BUFFER)
+	// Le contenu de l'afficheur est inconnu : tout sera envoyé au premier LCD_Flush()
+	for (uint8_t i = 0; i < LCD_BUFFER_SIZE; i++)
+	{
+		LCD_display->buffer[i] = ' ';
+	}
+	for (uint8_t i = 0; i < sizeof(LCD_display->dirty); i++)
+	{
+		LCD_display->dirty[i] = 0xFF;
+	}
+#endif
+}
+
+void LCD_Initialize(void)
+{
+#if defined(LCD_MARQUEE)
+	// Plus de nouvelle écriture de texte défilant pendant l'accès direct au bus
+	LCD_marquee_hold = 1;
+	for (uint8_t line = 0; line < LCD_LINE_COUNT; line++)
+	{
+		LCD_display->marquee[line].period = 0;
+		LCD_display->marquee[line].due    = 0;
+	}
+#endif
+#if defined(LCD_ASYNC)
+	// Les files d'attente des autres afficheurs doivent être vides pour accéder directement au bus
+	LCD_AsyncWait();
+#endif
+
+	LCD_BusInitialize();
+
+#if defined(LCD_FAST_INIT)
+	if (LCD_PowerOnWait())
+	{
+#  if defined(LCD_INTERFACE_4BITS)
+		// Interface en mode 8 bits après la réinitialisation interne : passage direct en mode 4 bits
+		LCD_BusWriteInit(0b00100000);
+		_delay_us(42);
+#  endif
+	}
+	else
+	{
+		// Réinitialisation interne non constatée : séquence de la datasheet
+		_delay_ms(LCD_POWER_ON_MS);
+		LCD_Synchronize();
+	}
+#else
+	// Fin de la mise sous tension de l'afficheur
+	_delay_ms(LCD_POWER_ON_MS);
+#  if defined(LCD_INTERFACE_4BITS)
+	// L'afficheur démarre en mode 8 bits : passage en mode 4 bits
+	LCD_Synchronize();
+#  elif defined(LCD_HAS_BUSY_FLAG)
+	// Attente de la fin d'initialisation du LCD
+	LCD_BusWaitReady(LCD_BUSY_TIMEOUT);
+#  endif
+#endif
+#if defined(LCD_INTERFACE_4BITS)
+	// 4 bits, 2 lignes, 5x7 points
+	LCD_Execute(LCD_CMD_FUNC | LCD_FUNC_INTF | (LCD_LINES_2 << LCD_BIT_FUNC_LINS), LCD_SEND_COMMAND);
+#endif
+
+	LCD_InitializeState();
+
+#if defined(LCD_MARQUEE)
+	LCD_marquee_hold = 0;
+#endif
+}
+
+#if defined(LCD_ASYNC)
+
+void LCD_InitializeAsync(void)
+{
+#if defined(LCD_MARQUEE)
+	for (uint8_t line = 0; line < LCD_LINE_COUNT; line++)
+	{
+		LCD_display->marquee[line].period = 0;
+		LCD_display->marquee[line].due    = 0;
+	}
+#endif
+	// Les files d'attente des autres afficheurs doivent être vides pour accéder directement au bus
+	LCD_AsyncWait();
+
+	LCD_BusInitialize();
+
+	// Séquence de LCD_Initialize(), chaque temporisation étant réalisée par LCD_AsyncTick()
+	LCD_AsyncDelay(LCD_ASYNC_TICKS(LCD_POWER_ON_MS * 1000UL));
+#if defined(LCD_INTERFACE_4BITS)
+	LCD_AsyncPush(0b00110000, LCD_SEND_INIT);
+	LCD_AsyncDelay(LCD_ASYNC_TICKS(4100));
+	LCD_AsyncPush(0b00110000, LCD_SEND_INIT);
+	LCD_AsyncDelay(LCD_ASYNC_TICKS(100));
+	LCD_AsyncPush(0b00110000, LCD_SEND_INIT);
+	LCD_AsyncDelay(LCD_ASYNC_TICKS(42));
+	LCD_AsyncPush(0b00100000, LCD_SEND_INIT);
+	LCD_AsyncDelay(LCD_ASYNC_TICKS(42));
+	LCD_Send(LCD_CMD_FUNC | LCD_FUNC_INTF | (LCD_LINES_2 << LCD_BIT_FUNC_LINS), LCD_SEND_COMMAND);
+#endif
+
+	LCD_InitializeState();
+}
+
+#endif
+
+void LCD_SoftwareReset(void)
+{
+#if defined(LCD_MARQUEE)
+	LCD_marquee_hold = 1;
+#endif
+#if defined(LCD_ASYNC)
+	// Séquence temporisée exécutée directement, une fois la file d'attente vidée
+	LCD_AsyncWait();
+#endif
+
+#if defined(LCD_HAS_BUSY_FLAG)
+	// Fin de l'instruction précédente
+	LCD_BusWaitReady(LCD_BUSY_TIMEOUT);
+#endif
+
+	// Init by software
+	LCD_Synchronize();
+	LCD_BusBegin();
+	LCD_Execute(0b00101100 | LCD_FUNC_INTF, LCD_SEND_COMMAND);
+	LCD_Execute(0b00001000, LCD_SEND_COMMAND);
+	LCD_Execute(0b00000001, LCD_SEND_LONG);
+	LCD_Execute(0b00000010, LCD_SEND_LONG);
+	LCD_Execute(0b00000110, LCD_SEND_COMMAND);
+	LCD_BusEnd();
+
+	LCD_display->address = LCD_CMD_SET_DDRAM;
+	LCD_display->shift   = 0;
+	LCD_display->entry   = 0b00000110;
+
+#if defined(LCD_MARQUEE)
+	// L'afficheur a été effacé
+	LCD_MarqueeRedraw();
+	LCD_marquee_hold = 0;
+#endif
+}
+
+void LCD_DisplayClear(void)
+{
+	LCD_Send(LCD_CMD_CLEAR, LCD_SEND_LONG);
+
+#if defined(LCD_MARQUEE)
+	// Textes défilants réécrits après l'effacement
+	LCD_MarqueeRedraw();
+#endif
+
+#if defined(LCD_BUFFER)
+	// L'afficheur ne contient plus que des espaces
+	for (uint8_t i = 0; i < LCD_BUFFER_SIZE; i++)
+	{
+		LCD_display->buffer[i] = ' ';
+	}
+	for (uint8_t i = 0; i < sizeof(LCD_display->dirty); i++)
+	{
+		LCD_display->dirty[i] = 0x00;
+	}
+#endif
+}
+
+void LCD_ReturnHome(void)
+{
+	LCD_Send(LCD_CMD_HOME, LCD_SEND_LONG);
+}
+
+void LCD_EntryMode(const LCD_CURSOR_DIR cursor_direction, const LCD_DISPLAY_TYPE display_type)
+{
+	SendCommand(LCD_CMD_ENTRY
+	| (display_type << LCD_BIT_ENTRY_SHIFT)
+	| (cursor_direction << LCD_BIT_ENTRY_INC));
+}
+
+void LCD_DisplayOn(const LCD_CURSOR_ACTIF cursor_actif, const LCD_CURSOR_BLINKING cursor_blinking)
+{
+	SendCommand(LCD_CMD_DISP
+	| (1 << LCD_BIT_DISP_DISP)
+	| (cursor_actif << LCD_BIT_DISP_CURS)
+	| (cursor_blinking << LCD_BIT_DISP_BLINK));
+}
+
+void LCD_DisplayOff(void)
+{
+	SendCommand(LCD_CMD_DISP | (0 << LCD_BIT_DISP_DISP));
+}
+
+static void LCD_SetShift(const uint8_t type, const uint8_t directory)
+{
+	SendCommand(LCD_CMD_SHIFT
+	| (type << LCD_BIT_SHIFT_TYPE)
+	| (directory << LCD_BIT_SHIFT_DIR));
+}
+
+void LCD_SetFunction(const LCD_LINES lines, const LCD_POLICE police)
+{
+	SendCommand(LCD_CMD_FUNC
+	| LCD_FUNC_INTF
+	| (lines << LCD_BIT_FUNC_LINS)
+	| (police << LCD_BIT_FUNC_DOTS));
+}
+
+/**
+ * @brief     Déplace le curseur sur l'anneau de 80 caractères formé par les deux lignes
+ *
+ * @param     [in]    delta     Déplacement vers la droite (0 à 79)
+ */
+static void LCD_MoveCursorBy(const uint8_t delta)
+{
+	uint8_t ddram = LCD_display->address & ~LCD_CMD_SET_DDRAM;
+	uint8_t index = (ddram >= LCD_OFFSET_LINE) ? ddram - LCD_OFFSET_LINE + LCD_LINE_LENGTH : ddram;
+
+	index = (index + delta) % (LCD_LINE_COUNT * LCD_LINE_LENGTH);
+	LCD_MoveCursor(index / LCD_LINE_LENGTH, index % LCD_LINE_LENGTH);
+}
+
+void LCD_MoveCursorRight(uint8_t count)
+{
+	LCD_MoveCursorBy(count % (LCD_LINE_COUNT * LCD_LINE_LENGTH));
+}
+
+void LCD_MoveCursorLeft(uint8_t count)
+{
+	LCD_MoveCursorBy((LCD_LINE_COUNT * LCD_LINE_LENGTH) - count % (LCD_LINE_COUNT * LCD_LINE_LENGTH));
+}
+
+void LCD_SetDisplayOffset(uint8_t offset)
+{
+	// Nombre de décalages à gauche pour atteindre le décalage demandé
+	uint8_t count = (offset % LCD_LINE_LENGTH + LCD_LINE_LENGTH - LCD_display->shift) % LCD_LINE_LENGTH;
+
+	// Sens le plus court sur l'anneau de 40 colonnes
+	if (count <= LCD_LINE_LENGTH / 2)
+	{
+		while(count--)
+		{
+			LCD_SetShift(1, 0);
+		}
+	}
+	else
+	{
+		count = LCD_LINE_LENGTH - count;
+		while(count--)
+		{
+			LCD_SetShift(1, 1);
+		}
+	}
+}
+
+void LCD_MoveDisplayRight(uint8_t count)
+{
+	LCD_SetDisplayOffset(LCD_display->shift + LCD_LINE_LENGTH - count % LCD_LINE_LENGTH);
+}
+
+void LCD_MoveDisplayLeft(uint8_t count)
+{
+	LCD_SetDisplayOffset(LCD_display->shift + count % LCD_LINE_LENGTH);
+}
+
+void LCD_MoveCursor(const uint8_t line, const uint8_t column)
 {
-	// On allume la limière
-	LCD_CONTROL_PORT |=  _BV(LCD_CONTROL_EN_PIN);
-	__asm__("NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;");
-	__asm__("NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;");
-	// On éteint la lumière pour que le LCD puisse "réfléchir"
-	LCD_CONTROL_PORT &= ~_BV(LCD_CONTROL_EN_PIN);
+	uint8_t command = LCD_CMD_SET_DDRAM | ((LCD_OFFSET_LINE * line) + column);
+
+	// Le curseur est déjà à la position demandée
+	if (LCD_display->address != command)
+	{
+		SendCommand(command);
+	}
 }
 
-static void CheckIfLcdIsBusy(void)
+/**
+ * @brief     Enregistre des caractères consécutifs en CGRAM
+ * @details   L'adresse CGRAM n'est envoyée qu'une fois : l'afficheur l'incrémente après
+ *            chaque ligne écrite.
+ *
+ * @param     [in]    adress    Adresse CGRAM du premier caractère
+ * @param     [in]    data      Représentation des caractères (8 octets par caractère)
+ * @param     [in]    count     Nombre de caractères
+ * @param     [in]    flash     Non nul si data est en mémoire flash
+ */
+static void LCD_UploadCharacters(const LCD_CGRAM adress, const uint8_t data[], const uint8_t count, const uint8_t flash)
 {
-    /**
-     * @todo Direction à changer lorsque le mode 4bits sera fait
-     */
-	// On positionne le bus de donnée du µC en lecture
-	LCD_DATA_DDR = 0x00;
+	uint8_t cursor = LCD_display->address;
+	uint8_t entry  = LCD_display->entry;
+	uint8_t size   = count << 3;
 
-	// set R/W et unset RS
-	LCD_CONTROL_PORT &= ~_BV(LCD_CONTROL_RS_PIN);	// Turn on Mr LCD's Command Mode (RS off)
-	LCD_CONTROL_PORT |=  _BV(LCD_CONTROL_RW_PIN);	// Set Mr. LCD to Read (RW on)
+#if defined(LCD_GLYPH_CACHE)
+	// Les adresses ne contiennent plus les caractères du cache
+	for (uint8_t i = 0; i < count; i++)
+	{
+		LCD_display->glyph_tag[adress + i] = NULL;
+	}
+#endif
 
-	while (LCD_DATA_PORT >= LCD_MSK_BUSY_FLG)
+#if defined(LCD_GRAPHICS)
+	// Jeux de caractères remplacés, même partiellement
+	if (adress < LCD_CGRAM_BAR + 4 && adress + count > LCD_CGRAM_BAR)
+	{
+		LCD_display->charsets &= ~LCD_CHARSET_BAR;
+	}
+	if (adress < LCD_CGRAM_BIG + 3 && adress + count > LCD_CGRAM_BIG)
 	{
-		Strobe();
+		LCD_display->charsets &= ~LCD_CHARSET_BIG;
 	}
+#endif
 
-	// On positionne le bus de donnée du µC en écriture
-	LCD_DATA_DDR = 0xFF;
+	LCD_SendBegin();
+	// Le compteur d'adresse doit être incrémenté après chaque écriture
+	if (!(entry & _BV(LCD_BIT_ENTRY_INC)))
+	{
+		SendCommand(entry | _BV(LCD_BIT_ENTRY_INC));
+	}
+	SendCommand(LCD_CMD_SET_CGRAM | (adress << 3));
+	for (uint8_t i = 0; i < size; i++)
+	{
+		LCD_PrintChar(flash ? pgm_read_byte(&(data[i])) : data[i]);
+	}
+	if (!(entry & _BV(LCD_BIT_ENTRY_INC)))
+	{
+		SendCommand(entry);
+	}
+	// Retour du compteur d'adresse en DDRAM, à la position du curseur
+	SendCommand(cursor);
+	LCD_SendEnd();
 }
 
-static void SendCommand(const uint8_t command)
+void LCD_RegisterCharacter_P(const LCD_CGRAM adress, const uint8_t data[])
 {
-	CheckIfLcdIsBusy();
-	LCD_DATA_PORT = command;
-	LCD_CONTROL_PORT &= ~(_BV(LCD_CONTROL_RW_PIN)|_BV(LCD_CONTROL_RS_PIN));	// (RS off) (RW off)
-	Strobe();
-	LCD_DATA_PORT = 0x00;
+	LCD_UploadCharacters(adress, data, 1, 1);
 }
 
-void LCD_PrintChar(const unsigned char character)
+void LCD_RegisterCharacter(const LCD_CGRAM adress, const uint8_t data[])
 {
-	CheckIfLcdIsBusy();
-	LCD_DATA_PORT = character;
-	LCD_CONTROL_PORT &= ~_BV(LCD_CONTROL_RW_PIN);		// (RW off)
-	LCD_CONTROL_PORT |=  _BV(LCD_CONTROL_RS_PIN);		// (RS on)
-	Strobe();
-	_delay_us(46);
-	LCD_DATA_PORT = 0x00;
+	LCD_UploadCharacters(adress, data, 1, 0);
 }
 
-void LCD_PrintString(const char * string)
+void LCD_RegisterCharacters_P(const LCD_CGRAM adress, const uint8_t data[], const uint8_t count)
 {
-	while(*string)
+	LCD_UploadCharacters(adress, data, count, 1);
+}
+
+void LCD_RegisterCharacters(const LCD_CGRAM adress, const uint8_t data[], const uint8_t count)
+{
+	LCD_UploadCharacters(adress, data, count, 0);
+}
+
+#if defined(LCD_READBACK)
+
+/**
+ * @brief     Lit l'octet de la mémoire de l'afficheur (DDRAM ou CGRAM) à l'adresse courante
+ * @details   Après une écriture ou une commande autre qu'un positionnement, le registre de
+ *            lecture de l'afficheur ne contient pas l'octet à l'adresse courante : l'adresse
+ *            est alors de nouveau envoyée. Les lectures successives n'envoient aucune commande.
+ */
+static uint8_t LCD_Read(void)
+{
+	if (!LCD_display->latched)
 	{
-		LCD_PrintChar(*string++);
+		SendCommand(LCD_display->address);
 	}
+
+	// Le compteur d'adresse avance comme après une écriture, sans décalage de l'affichage
+	LCD_display->address = LCD_StepAddress(LCD_display->address, LCD_display->entry & _BV(LCD_BIT_ENTRY_INC));
+
+	LCD_BusWaitReady(LCD_BUSY_TIMEOUT);
+	return LCD_BusRead();
 }
 
-void LCD_Initialize(void)
+uint8_t LCD_ReadChar(void)
+{
+	return LCD_Read();
+}
+
+void LCD_ReadCharacter(const LCD_CGRAM adress, uint8_t data[])
 {
-	LCD_CONTROL_DDR |= _BV(LCD_CONTROL_EN_PIN)|_BV(LCD_CONTROL_RW_PIN)|_BV(LCD_CONTROL_RS_PIN);	// (EN on) (RS on) (RW on)
-	/**
-	 * @todo Direction à changer lorsque le mode 4bits sera fait
-	 */
-	LCD_DATA_DDR    |= 0xFF;	// Port des datas en sortie
+	uint8_t cursor = LCD_display->address;
+	uint8_t entry  = LCD_display->entry;
 
-	// wait 10 ms for busy state
-	_delay_ms(10);
-	// Attente de la fin d'initialisation du LCD
-	CheckIfLcdIsBusy();
+	// Le compteur d'adresse doit être incrémenté après chaque lecture
+	if (!(entry & _BV(LCD_BIT_ENTRY_INC)))
+	{
+		SendCommand(entry | _BV(LCD_BIT_ENTRY_INC));
+	}
+	SendCommand(LCD_CMD_SET_CGRAM | (adress << 3));
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		data[i] = LCD_Read();
+	}
+	if (!(entry & _BV(LCD_BIT_ENTRY_INC)))
+	{
+		SendCommand(entry);
+	}
+	// Retour du compteur d'adresse en DDRAM, à la position du curseur
+	SendCommand(cursor);
 }
 
-void LCD_SoftwareReset(void)
+/**
+ * @brief     Ecrit les caractères d'un texte qui diffèrent de ceux affichés
+ * @details   Les caractères affichés sont lus par blocs de LCD_UPDATE_CHUNK (lectures
+ *            successives, une seule commande de positionnement), puis seuls ceux qui diffèrent
+ *            sont écrits. Le compteur d'adresse est laissé après le dernier caractère.
+ *
+ * @param     [in]    text      Caractères à afficher
+ * @param     [in]    length    Nombre de caractères
+ * @param     [in]    flash     Non nul si le texte est en mémoire flash
+ */
+static void LCD_UpdateText(const char * text, uint8_t length, const uint8_t flash)
 {
-	// Init by software
-	SendCommand(0b00110000);
-	_delay_ms(4.1);
-	SendCommand(0b00110000);
-	_delay_ms(100);
-	SendCommand(0b00110000);
-	CheckIfLcdIsBusy();
-	SendCommand(0b00111100);
-	_delay_us(42);
-	SendCommand(0b00001000);
-	_delay_us(42);
-	SendCommand(0b00000001);
-	_delay_ms(1.64);
-	SendCommand(0b00000010);
-	_delay_us(42);
+	uint8_t increment = LCD_display->entry & _BV(LCD_BIT_ENTRY_INC);
+	uint8_t wanted[LCD_UPDATE_CHUNK];
+	uint8_t current[LCD_UPDATE_CHUNK];
+
+	while (length)
+	{
+		uint8_t count   = length < LCD_UPDATE_CHUNK ? length : LCD_UPDATE_CHUNK;
+		uint8_t address = LCD_display->address;
+
+		for (uint8_t i = 0; i < count; i++)
+		{
+			wanted[i]  = flash ? pgm_read_byte(text++) : *text++;
+			current[i] = LCD_Read();
+		}
+
+		for (uint8_t i = 0; i < count; i++)
+		{
+			if (current[i] != wanted[i])
+			{
+				// Positionnement au début de chaque suite de caractères modifiés
+				if (LCD_display->address != address)
+				{
+					SendCommand(address);
+				}
+				LCD_PrintChar(wanted[i]);
+			}
+			address = LCD_StepAddress(address, increment);
+		}
+
+		// Compteur d'adresse après le dernier caractère du bloc
+		if (LCD_display->address != address)
+		{
+			SendCommand(address);
+		}
+
+		length -= count;
+	}
 }
 
-void LCD_DisplayClear(void)
+void LCD_UpdateChar(const unsigned char character)
 {
-	SendCommand(LCD_CMD_CLEAR);
-	_delay_ms(1.64);
+	LCD_UpdateText((const char *)&character, 1, 0);
 }
 
-void LCD_ReturnHome(void)
+void LCD_UpdateString(const char * string)
 {
-	SendCommand(LCD_CMD_HOME);
-	_delay_ms(1.64);
+	LCD_UpdateText(string, strlen(string), 0);
 }
 
-void LCD_EntryMode(const LCD_CURSOR_DIR cursor_direction, const LCD_DISPLAY_TYPE display_type)
+void LCD_UpdateString_P(const char * string)
 {
-	SendCommand(LCD_CMD_ENTRY
-	| (display_type << LCD_BIT_ENTRY_SHIFT)
-	| (cursor_direction << LCD_BIT_ENTRY_INC));
-	_delay_us(42);
+	LCD_UpdateText(string, strlen_P(string), 1);
 }
 
-void LCD_DisplayOn(const LCD_CURSOR_ACTIF cursor_actif, const LCD_CURSOR_BLINKING cursor_blinking)
+void LCD_UpdateScreen_P(const char * screen)
 {
-	SendCommand(LCD_CMD_DISP
-	| (1 << LCD_BIT_DISP_DISP)
-	| (cursor_actif << LCD_BIT_DISP_CURS)
-	| (cursor_blinking << LCD_BIT_DISP_BLINK));
-	_delay_us(42);
+	for (uint8_t line = 0; line < LCD_LINE_COUNT; line++)
+	{
+		LCD_MoveCursor(line, 0);
+		LCD_UpdateText(screen, LCD_DISPLAY_WIDTH, 1);
+		screen += LCD_DISPLAY_WIDTH;
+	}
 }
 
-void LCD_DisplayOff(void)
+#endif
+
+#if defined(LCD_STREAM)
+
+void LCD_StreamFlush(void)
 {
-	SendCommand(LCD_CMD_DISP | (0 << LCD_BIT_DISP_DISP));
-	_delay_us(42);
+	if (!LCD_display->stream_count)
+	{
+		return;
+	}
+
+	LCD_SendBegin();
+	LCD_MoveCursor(LCD_display->stream_line, LCD_display->stream_column);
+	for (uint8_t i = 0; i < LCD_display->stream_count; i++)
+	{
+		LCD_PrintChar(LCD_display->stream_buffer[i]);
+	}
+	LCD_SendEnd();
+
+	LCD_display->stream_column += LCD_display->stream_count;
+	LCD_display->stream_count = 0;
 }
 
-static void LCD_SetShift(const uint8_t type, const uint8_t directory)
+int LCD_StreamPut(char character, FILE * stream)
 {
-	SendCommand(LCD_CMD_SHIFT
-	| (type << LCD_BIT_SHIFT_TYPE)
-	| (directory << LCD_BIT_SHIFT_DIR));
-	_delay_us(42);
+	(void)stream;
+
+	switch (character)
+	{
+	case '\n':
+		LCD_StreamFlush();
+		LCD_display->stream_line   = (LCD_display->stream_line + 1) % LCD_LINE_COUNT;
+		LCD_display->stream_column = 0;
+		break;
+
+	case '\r':
+		LCD_StreamFlush();
+		LCD_display->stream_column = 0;
+		break;
+
+	case '\f':
+		// Les caractères en attente seraient effacés
+		LCD_display->stream_count  = 0;
+		LCD_display->stream_line   = 0;
+		LCD_display->stream_column = 0;
+		LCD_DisplayClear();
+		break;
+
+	default:
+		// Les caractères au-delà de la fin de la ligne sont ignorés
+		if (LCD_display->stream_column + LCD_display->stream_count >= LCD_LINE_LENGTH)
+		{
+			break;
+		}
+		if (LCD_display->stream_count == LCD_STREAM_SIZE)
+		{
+			LCD_StreamFlush();
+		}
+		LCD_display->stream_buffer[LCD_display->stream_count++] = character;
+		break;
+	}
+
+	return 0;
 }
 
-void LCD_SetFunction(const LCD_LINES lines, const LCD_POLICE police)
+#endif
+
+#if defined(LCD_GLYPH_CACHE)
+
+/**
+ * @brief     Marque une adresse CGRAM comme la plus récemment utilisée
+ */
+static void LCD_GlyphTouch(const uint8_t slot)
 {
-	/**
-	 * @todo L'interface LCD est forcée à 8 bits pour le moment. Permettre
-	 * l'utilisation en interface 4 bits.
-	 */
-	SendCommand(LCD_CMD_FUNC
-	| (1 << LCD_BIT_FUNC_INTF)
-	| (lines << LCD_BIT_FUNC_LINS)
-	| (police << LCD_BIT_FUNC_DOTS));
-	_delay_us(42);
+	uint8_t rank = LCD_display->glyph_rank[slot];
+
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		if (LCD_display->glyph_rank[i] < rank)
+		{
+			LCD_display->glyph_rank[i]++;
+		}
+	}
+	LCD_display->glyph_rank[slot] = 0;
 }
 
-void LCD_MoveCursorRight(uint8_t count)
+uint8_t LCD_GlyphGet(const uint8_t glyph[])
+{
+	uint8_t slot;
+	uint8_t visible = 0x00;
+
+	// Succès : aucun transfert vers l'afficheur
+	for (slot = 0; slot < 8; slot++)
+	{
+		if (LCD_display->glyph_tag[slot] == glyph)
+		{
+			LCD_GlyphTouch(slot);
+			return slot;
+		}
+	}
+
+#  if defined(LCD_BUFFER)
+	// Adresses CGRAM affichées (les codes 0x08 à 0x0F désignent aussi la CGRAM)
+	for (uint8_t i = 0; i < LCD_BUFFER_SIZE; i++)
+	{
+		if (LCD_display->buffer[i] < 0x10)
+		{
+			visible |= _BV(LCD_display->buffer[i] & 0x07);
+		}
+	}
+#  endif
+
+	// Adresse libre ou, à défaut, la moins récemment utilisée parmi celles non affichées
+	uint8_t victim = LCD_GLYPH_NONE;
+	for (slot = 0; slot < 8; slot++)
+	{
+		if (visible & _BV(slot))
+		{
+			continue;
+		}
+		if (!LCD_display->glyph_tag[slot])
+		{
+			victim = slot;
+			break;
+		}
+		if (victim == LCD_GLYPH_NONE || LCD_display->glyph_rank[slot] > LCD_display->glyph_rank[victim])
+		{
+			victim = slot;
+		}
+	}
+
+	if (victim != LCD_GLYPH_NONE)
+	{
+		LCD_RegisterCharacter_P(victim, glyph);
+		LCD_display->glyph_tag[victim] = glyph;
+		LCD_GlyphTouch(victim);
+	}
+
+	return victim;
+}
+
+void LCD_GlyphReset(void)
 {
-	while(count--)
+	for (uint8_t slot = 0; slot < 8; slot++)
 	{
-		LCD_SetShift(0, 1);
+		LCD_display->glyph_tag[slot]  = NULL;
+		LCD_display->glyph_rank[slot] = slot;
 	}
 }
 
-void LCD_MoveCursorLeft(uint8_t count)
+#endif
+
+#if defined(LCD_BUFFER)
+
+void LCD_BufferSetChar(const uint8_t line, const uint8_t column, const unsigned char character)
 {
-	while(count--)
+	uint8_t index = line * LCD_LINE_LENGTH + column;
+
+	// Caractère hors de la mémoire d'affichage
+	if (line >= LCD_LINE_COUNT || column >= LCD_LINE_LENGTH)
 	{
-		LCD_SetShift(0, 0);
+		return;
+	}
+
+	if (LCD_display->buffer[index] != character)
+	{
+		LCD_display->buffer[index] = character;
+		LCD_display->dirty[index >> 3] |= _BV(index & 0x07);
 	}
 }
 
-void LCD_MoveDisplayRight(uint8_t count)
+void LCD_BufferPrintString(const uint8_t line, uint8_t column, const char * string)
 {
-	while(count--)
+	while (*string && column < LCD_LINE_LENGTH)
 	{
-		LCD_SetShift(1, 1);
+		LCD_BufferSetChar(line, column++, *string++);
 	}
 }
 
-void LCD_MoveDisplayLeft(uint8_t count)
+void LCD_BufferPrintString_P(const uint8_t line, uint8_t column, const char * string)
 {
-	while(count--)
+	char character;
+
+	while ((character = pgm_read_byte(string++)) && column < LCD_LINE_LENGTH)
 	{
-		LCD_SetShift(1, 0);
+		LCD_BufferSetChar(line, column++, character);
 	}
 }
 
-void LCD_MoveCursor(const uint8_t line, const uint8_t column)
+void LCD_BufferPrintScreen_P(const char * screen)
 {
-	SendCommand(LCD_CMD_SET_DDRAM | ((LCD_OFFSET_LINE * line) + column));
-	_delay_us(42);
+	for (uint8_t line = 0; line < LCD_LINE_COUNT; line++)
+	{
+		for (uint8_t column = 0; column < LCD_DISPLAY_WIDTH; column++)
+		{
+			LCD_BufferSetChar(line, column, pgm_read_byte(screen++));
+		}
+	}
 }
 
-void LCD_RegisterCharacter_P(const LCD_CGRAM adress, const uint8_t data[])
+void LCD_BufferPrintUInt(const uint8_t line, const uint8_t column, const uint16_t value, const uint8_t width, const LCD_FILL fill)
 {
-	uint8_t command = LCD_CMD_SET_CGRAM | (adress << 3);
+	char text[LCD_NUMBER_SIZE];
 
-	for (uint8_t i = 0; i < 8; i++)
+	LCD_FormatNumber(text, value, 0, 0, width, fill, 0);
+	LCD_BufferPrintString(line, column, text);
+}
+
+void LCD_BufferPrintInt(const uint8_t line, const uint8_t column, const int16_t value, const uint8_t width, const LCD_FILL fill)
+{
+	LCD_BufferPrintFixed(line, column, value, 0, width, fill);
+}
+
+void LCD_BufferPrintFixed(const uint8_t line, const uint8_t column, const int16_t value, const uint8_t decimals, const uint8_t width, const LCD_FILL fill)
+{
+	char text[LCD_NUMBER_SIZE];
+
+	LCD_FormatNumber(text, (value < 0) ? 0U - (uint16_t)value : (uint16_t)value, value < 0, decimals, width, fill, 0);
+	LCD_BufferPrintString(line, column, text);
+}
+
+void LCD_BufferPrintHex(const uint8_t line, const uint8_t column, const uint16_t value, const uint8_t width, const LCD_FILL fill)
+{
+	char text[LCD_NUMBER_SIZE];
+
+	LCD_FormatNumber(text, value, 0, 0, width, fill, 1);
+	LCD_BufferPrintString(line, column, text);
+}
+
+void LCD_BufferClear(void)
+{
+	for (uint8_t line = 0; line < LCD_LINE_COUNT; line++)
 	{
-		SendCommand(command++);
-		_delay_us(42);
-		LCD_PrintChar(pgm_read_byte(&(data[i])));
+		for (uint8_t column = 0; column < LCD_LINE_LENGTH; column++)
+		{
+			LCD_BufferSetChar(line, column, ' ');
+		}
 	}
 }
 
-void LCD_RegisterCharacter(const LCD_CGRAM adress, const uint8_t data[])
+void LCD_Flush(void)
 {
-	uint8_t command = LCD_CMD_SET_CGRAM | (adress << 3);
+	LCD_SendBegin();
+	for (uint8_t index = 0; index < LCD_BUFFER_SIZE; index++)
+	{
+		// Saut rapide des groupes de 8 caractères non modifiés
+		if ((index & 0x07) == 0 && LCD_display->dirty[index >> 3] == 0x00)
+		{
+			index += 7;
+			continue;
+		}
 
-	for (uint8_t i = 0; i < 8; i++)
+		if (!(LCD_display->dirty[index >> 3] & _BV(index & 0x07)))
+		{
+			continue;
+		}
+
+		// Positionnement uniquement si le curseur n'est pas déjà sur le caractère
+		LCD_MoveCursor(index / LCD_LINE_LENGTH, index % LCD_LINE_LENGTH);
+		LCD_PrintChar(LCD_display->buffer[index]);
+	}
+	LCD_SendEnd();
+
+	for (uint8_t i = 0; i < sizeof(LCD_display->dirty); i++)
 	{
-		SendCommand(command++);
-		_delay_us(42);
-		LCD_PrintChar(data[i]);
+		LCD_display->dirty[i] = 0x00;
+	}
+}
+
+#endif
+
+#if defined(LCD_GRAPHICS)
+
+// Barres remplies de 1 à 4 colonnes (la barre pleine est le caractère LCD_CHAR_BLOCK)
+static const uint8_t LCD_charset_bar[4 * 8] PROGMEM = {
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+	0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+};
+
+// Segments des grands chiffres : barre haute, barre basse, barres haute et basse
+static const uint8_t LCD_charset_big[3 * 8] PROGMEM = {
+	0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F,
+	0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,
+};
+
+#  define LCD_BIG_T               (LCD_CGRAM_BIG + 0)
+#  define LCD_BIG_B               (LCD_CGRAM_BIG + 1)
+#  define LCD_BIG_TB              (LCD_CGRAM_BIG + 2)
+#  define LCD_BIG_F               LCD_CHAR_BLOCK
+#  define LCD_BIG__               ' '
+
+// Grands chiffres de 3 colonnes sur 2 lignes : 0 à 9, '-' (LCD_BIG_MINUS) et espace (LCD_BIG_BLANK)
+static const uint8_t LCD_big_digits[12][2 * LCD_BIG_WIDTH] PROGMEM = {
+	{ LCD_BIG_F,  LCD_BIG_T,  LCD_BIG_F,    LCD_BIG_F,  LCD_BIG_B,  LCD_BIG_F  },
+	{ LCD_BIG_T,  LCD_BIG_F,  LCD_BIG__,    LCD_BIG_B,  LCD_BIG_F,  LCD_BIG_B  },
+	{ LCD_BIG_TB, LCD_BIG_TB, LCD_BIG_F,    LCD_BIG_F,  LCD_BIG_B,  LCD_BIG_B  },
+	{ LCD_BIG_TB, LCD_BIG_TB, LCD_BIG_F,    LCD_BIG_B,  LCD_BIG_B,  LCD_BIG_F  },
+	{ LCD_BIG_F,  LCD_BIG_B,  LCD_BIG_F,    LCD_BIG__,  LCD_BIG__,  LCD_BIG_F  },
+	{ LCD_BIG_F,  LCD_BIG_TB, LCD_BIG_TB,   LCD_BIG_B,  LCD_BIG_B,  LCD_BIG_F  },
+	{ LCD_BIG_F,  LCD_BIG_TB, LCD_BIG_TB,   LCD_BIG_F,  LCD_BIG_B,  LCD_BIG_F  },
+	{ LCD_BIG_T,  LCD_BIG_T,  LCD_BIG_F,    LCD_BIG__,  LCD_BIG__,  LCD_BIG_F  },
+	{ LCD_BIG_F,  LCD_BIG_TB, LCD_BIG_F,    LCD_BIG_F,  LCD_BIG_B,  LCD_BIG_F  },
+	{ LCD_BIG_F,  LCD_BIG_TB, LCD_BIG_F,    LCD_BIG_B,  LCD_BIG_B,  LCD_BIG_F  },
+	{ LCD_BIG_B,  LCD_BIG_B,  LCD_BIG_B,    LCD_BIG__,  LCD_BIG__,  LCD_BIG__  },
+	{ LCD_BIG__,  LCD_BIG__,  LCD_BIG__,    LCD_BIG__,  LCD_BIG__,  LCD_BIG__  },
+};
+
+/**
+ * @brief     Enregistre un jeu de caractères en CGRAM s'il n'y est pas déjà
+ */
+static void LCD_LoadCharset(const uint8_t charset)
+{
+	if (LCD_display->charsets & charset)
+	{
+		return;
+	}
+
+	if (charset == LCD_CHARSET_BAR)
+	{
+		LCD_RegisterCharacters_P(LCD_CGRAM_BAR, LCD_charset_bar, 4);
+	}
+	else
+	{
+		LCD_RegisterCharacters_P(LCD_CGRAM_BIG, LCD_charset_big, 3);
+	}
+	LCD_display->charsets |= charset;
+}
+
+/**
+ * @brief     Ecrit un caractère sur l'afficheur ou dans sa copie en RAM
+ * @details   Sur l'afficheur, le caractère n'est envoyé que s'il diffère de celui affiché
+ *            d'après la copie en RAM, qui est mise à jour.
+ *
+ * @param     [in]    buffer    Non nul pour écrire dans la copie en RAM
+ */
+static void LCD_PutCell(const uint8_t line, const uint8_t column, const uint8_t character, const uint8_t buffer)
+{
+	uint8_t index = line * LCD_LINE_LENGTH + column;
+	uint8_t mask  = _BV(index & 0x07);
+
+	if (buffer)
+	{
+		LCD_BufferSetChar(line, column, character);
+		return;
+	}
+
+	// Caractère hors de la mémoire d'affichage, ou déjà affiché
+	if (line >= LCD_LINE_COUNT || column >= LCD_LINE_LENGTH
+		|| (LCD_display->buffer[index] == character && !(LCD_display->dirty[index >> 3] & mask)))
+	{
+		return;
+	}
+	LCD_display->buffer[index] = character;
+	LCD_display->dirty[index >> 3] &= ~mask;
+
+	// Sans commande si le caractère suit le précédent
+	LCD_MoveCursor(line, column);
+	LCD_PrintChar(character);
+}
+
+static void LCD_Bar(const uint8_t line, const uint8_t column, const uint8_t width, uint8_t value, const uint8_t buffer)
+{
+	LCD_LoadCharset(LCD_CHARSET_BAR);
+
+	if (!buffer)
+	{
+		LCD_SendBegin();
+	}
+	for (uint8_t i = 0; i < width; i++)
+	{
+		uint8_t character;
+
+		if (value >= 5)
+		{
+			character = LCD_CHAR_BLOCK;
+			value -= 5;
+		}
+		else if (value)
+		{
+			character = LCD_CGRAM_BAR + value - 1;
+			value = 0;
+		}
+		else
+		{
+			character = ' ';
+		}
+		LCD_PutCell(line, column + i, character, buffer);
+	}
+	if (!buffer)
+	{
+		LCD_SendEnd();
+	}
+}
+
+static void LCD_BigDigit(const uint8_t column, const uint8_t digit, const uint8_t buffer)
+{
+	const uint8_t * cells = LCD_big_digits[(digit < 12) ? digit : LCD_BIG_BLANK];
+
+	LCD_LoadCharset(LCD_CHARSET_BIG);
+
+	if (!buffer)
+	{
+		LCD_SendBegin();
+	}
+	for (uint8_t line = 0; line < 2; line++)
+	{
+		for (uint8_t i = 0; i < LCD_BIG_WIDTH; i++)
+		{
+			LCD_PutCell(line, column + i, pgm_read_byte(cells++), buffer);
+		}
+	}
+	if (!buffer)
+	{
+		LCD_SendEnd();
+	}
+}
+
+static void LCD_BigNumber(uint8_t column, const int16_t value, const uint8_t width, const uint8_t buffer)
+{
+	char text[LCD_NUMBER_SIZE];
+
+	LCD_FormatNumber(text, (value < 0) ? 0U - (uint16_t)value : (uint16_t)value, value < 0, 0, width, LCD_FILL_SPACE, 0);
+
+	for (char * character = text; *character; character++, column += LCD_BIG_WIDTH + 1)
+	{
+		uint8_t digit = (*character == '-') ? LCD_BIG_MINUS : (*character == ' ') ? LCD_BIG_BLANK : *character - '0';
+
+		LCD_BigDigit(column, digit, buffer);
+		// Colonne d'espacement entre deux chiffres
+		LCD_PutCell(0, column + LCD_BIG_WIDTH, ' ', buffer);
+		LCD_PutCell(1, column + LCD_BIG_WIDTH, ' ', buffer);
 	}
 }
 
+void LCD_DrawBar(const uint8_t line, const uint8_t column, const uint8_t width, const uint8_t value)
+{
+	LCD_Bar(line, column, width, value, 0);
+}
+
+void LCD_DrawBigDigit(const uint8_t column, const uint8_t digit)
+{
+	LCD_BigDigit(column, digit, 0);
+}
+
+void LCD_DrawBigNumber(const uint8_t column, const int16_t value, const uint8_t width)
+{
+	LCD_BigNumber(column, value, width, 0);
+}
+
+void LCD_BufferDrawBar(const uint8_t line, const uint8_t column, const uint8_t width, const uint8_t value)
+{
+	LCD_Bar(line, column, width, value, 1);
+}
+
+void LCD_BufferDrawBigDigit(const uint8_t column, const uint8_t digit)
+{
+	LCD_BigDigit(column, digit, 1);
+}
+
+void LCD_BufferDrawBigNumber(const uint8_t column, const int16_t value, const uint8_t width)
+{
+	LCD_BigNumber(column, value, width, 1);
+}
+
+#endif
+
 #endif /* _162C_CORE_H_ */
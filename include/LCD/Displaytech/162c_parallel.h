@@ -0,0 +1,246 @@
+/*
+ * @file      162c_parallel.h
+ *
+ * @author    Zéro Cool
+ * @date      12/09/2013 13:34:33
+ * @brief     Transport parallèle du driver pour afficheur LCD de la série 162c
+ *
+ * @details   Accès direct aux broches de l'afficheur (interface 8 bits ou 4 bits).
+ *            Fichier inclus par 162c_core.h, il fournit les fonctions LCD_Busxxx
+ *            utilisées par la couche commandes du driver.
+ *
+ * @ingroup   LCD
+ */
+
+#ifndef _162C_PARALLEL_H_
+#define _162C_PARALLEL_H_
+
+// Le busy flag n'est lisible que si la broche R/W est pilotée
+#if defined(LCD_CONTROL_RW_PIN)
+#  define LCD_HAS_BUSY_FLAG
+#endif
+
+#if defined(LCD_INTERFACE_4BITS)
+// Broches du PORT data reliées à DB4..DB7
+#  define LCD_DATA_MASK           (0x0F << LCD_DATA_SHIFT)
+// Broche du PORT data sur laquelle le busy flag (DB7) est lu
+#  define LCD_PIN_BUSY_FLG        (0x08 << LCD_DATA_SHIFT)
+
+// Position des quartets haut et bas d'un octet sur les broches DB4..DB7
+#  if LCD_DATA_SHIFT == 4
+#    define LCD_NIBBLE_HIGH(v)    ((v) & 0xF0)
+#    define LCD_NIBBLE_LOW(v)     ((uint8_t)((v) << 4))
+#  else
+#    define LCD_NIBBLE_HIGH(v)    ((v) >> 4)
+#    define LCD_NIBBLE_LOW(v)     ((v) & 0x0F)
+#  endif
+
+// Quartet lu sur les broches DB4..DB7
+#  define LCD_NIBBLE_READ(p)      (((p) & LCD_DATA_MASK) >> LCD_DATA_SHIFT)
+
+// Changement de direction des seules broches DB4..DB7
+#  define LCD_DATA_INPUT()        LCD_DATA_DDR &= ~LCD_DATA_MASK
+#  define LCD_DATA_OUTPUT()       LCD_DATA_DDR |=  LCD_DATA_MASK
+#else
+#  define LCD_PIN_BUSY_FLG        LCD_MSK_BUSY_FLG
+
+#  define LCD_DATA_INPUT()        LCD_DATA_DDR = 0x00
+#  define LCD_DATA_OUTPUT()       LCD_DATA_DDR = 0xFF
+#endif
+
+#if LCD_DISPLAY_COUNT > 1
+// Broches EN des afficheurs, les autres broches étant partagées
+static const uint8_t LCD_enable[LCD_DISPLAY_COUNT] = {
+	_BV(LCD_CONTROL_EN_PIN),
+	_BV(LCD_CONTROL_EN_PIN_1),
+#  if LCD_DISPLAY_COUNT > 2
+	_BV(LCD_CONTROL_EN_PIN_2),
+#  endif
+#  if LCD_DISPLAY_COUNT > 3
+	_BV(LCD_CONTROL_EN_PIN_3),
+#  endif
+};
+
+// Broche EN de l'afficheur auquel s'adressent les accès au bus
+static uint8_t LCD_bus_enable = _BV(LCD_CONTROL_EN_PIN);
+
+#  define LCD_EN_MASK             LCD_bus_enable
+#  define LCD_BusSelect(display)  LCD_bus_enable = LCD_enable[display]
+#else
+#  define LCD_EN_MASK             _BV(LCD_CONTROL_EN_PIN)
+#  define LCD_BusSelect(display)
+#endif
+
+// Les écritures sont indépendantes : pas de transaction à ouvrir
+#define LCD_BusBegin()
+#define LCD_BusEnd()
+
+// Pull-up sur DB7, actif pendant les lectures du busy flag : busy flag lu à 1 tant que
+// l'afficheur ne pilote pas le bus
+#define LCD_BusPullUp()           LCD_DATA_PORT |= LCD_PIN_BUSY_FLG
+
+static void Strobe(void)
+{
+	// On allume la limière
+	LCD_CONTROL_PORT |=  LCD_EN_MASK;
+	__asm__("NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;");
+	__asm__("NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;");
+	// On éteint la lumière pour que le LCD puisse "réfléchir"
+	LCD_CONTROL_PORT &= ~LCD_EN_MASK;
+}
+
+/**
+ * @brief     Configure les broches de l'afficheur
+ */
+static void LCD_BusInitialize(void)
+{
+	LCD_CONTROL_DDR |= _BV(LCD_CONTROL_EN_PIN)|_BV(LCD_CONTROL_RS_PIN);	// (EN on) (RS on)
+#if LCD_DISPLAY_COUNT > 1
+	for (uint8_t i = 1; i < LCD_DISPLAY_COUNT; i++)
+	{
+		LCD_CONTROL_DDR |= LCD_enable[i];
+	}
+#endif
+#if defined(LCD_CONTROL_RW_PIN)
+	LCD_CONTROL_DDR |= _BV(LCD_CONTROL_RW_PIN);	// (RW on)
+#endif
+	LCD_DATA_OUTPUT();	// Port des datas en sortie
+}
+
+#if defined(LCD_HAS_BUSY_FLAG)
+
+/**
+ * @brief     Attend que l'afficheur soit prêt
+ * @details   Lit le busy flag (BF) jusqu'à ce qu'il retombe, au plus tries fois
+ *
+ * @param     [in]    tries     Nombre maximal de lectures du busy flag
+ *
+ * @return    0 si l'afficheur est prêt, une valeur non nulle s'il est toujours occupé
+ */
+static uint8_t LCD_BusWaitReady(uint16_t tries)
+{
+	uint8_t status;
+
+	// On positionne le bus de donnée du µC en lecture
+	LCD_DATA_INPUT();
+
+	// set R/W et unset RS
+	LCD_CONTROL_PORT &= ~_BV(LCD_CONTROL_RS_PIN);	// Turn on Mr LCD's Command Mode (RS off)
+	LCD_CONTROL_PORT |=  _BV(LCD_CONTROL_RW_PIN);	// Set Mr. LCD to Read (RW on)
+
+	while (1)
+	{
+		// Le busy flag est présenté sur DB7 tant que EN est maintenu à l'état haut
+		LCD_CONTROL_PORT |=  LCD_EN_MASK;
+		_delay_us(1);
+		status = LCD_DATA_PIN & LCD_PIN_BUSY_FLG;
+		LCD_CONTROL_PORT &= ~LCD_EN_MASK;
+#if defined(LCD_INTERFACE_4BITS)
+		// Le quartet bas (compteur d'adresse) doit être lu pour terminer la lecture
+		_delay_us(1);
+		Strobe();
+#endif
+
+		if (!status || !--tries)
+		{
+			break;
+		}
+		_delay_us(1);
+	}
+
+	LCD_CONTROL_PORT &= ~_BV(LCD_CONTROL_RW_PIN);	// (RW off)
+
+	// On positionne le bus de donnée du µC en écriture
+	LCD_DATA_OUTPUT();
+
+	return status;
+}
+
+#endif
+
+#if defined(LCD_READBACK)
+
+/**
+ * @brief     Lit un octet de la mémoire de l'afficheur (DDRAM ou CGRAM)
+ * @details   Le compteur d'adresse de l'afficheur avance (ou recule) après la lecture
+ *
+ * @return    Octet lu à l'adresse courante
+ */
+static uint8_t LCD_BusRead(void)
+{
+	uint8_t value;
+
+	LCD_DATA_INPUT();
+
+	LCD_CONTROL_PORT |=  _BV(LCD_CONTROL_RS_PIN)|_BV(LCD_CONTROL_RW_PIN);	// (RS on) (RW on)
+
+	LCD_CONTROL_PORT |=  LCD_EN_MASK;
+	_delay_us(1);
+#if defined(LCD_INTERFACE_4BITS)
+	value = LCD_NIBBLE_READ(LCD_DATA_PIN) << 4;
+	LCD_CONTROL_PORT &= ~LCD_EN_MASK;
+	_delay_us(1);
+	LCD_CONTROL_PORT |=  LCD_EN_MASK;
+	_delay_us(1);
+	value |= LCD_NIBBLE_READ(LCD_DATA_PIN);
+#else
+	value = LCD_DATA_PIN;
+#endif
+	LCD_CONTROL_PORT &= ~LCD_EN_MASK;
+
+	LCD_CONTROL_PORT &= ~_BV(LCD_CONTROL_RW_PIN);	// (RW off)
+
+	LCD_DATA_OUTPUT();
+
+	return value;
+}
+
+#endif
+
+/**
+ * @brief     Ecrit un octet sur le bus de l'afficheur
+ *
+ * @param     [in]    value     Commande ou caractère à écrire
+ * @param     [in]    flags     Combinaison de LCD_SEND_xxx
+ */
+static void LCD_BusWrite(const uint8_t value, const uint8_t flags)
+{
+	if (flags & LCD_SEND_DATA)
+	{
+		LCD_CONTROL_PORT |=  _BV(LCD_CONTROL_RS_PIN);	// (RS on)
+	}
+	else
+	{
+		LCD_CONTROL_PORT &= ~_BV(LCD_CONTROL_RS_PIN);	// (RS off)
+	}
+#if defined(LCD_INTERFACE_4BITS)
+	// Les autres broches du PORT data ne sont pas modifiées
+	LCD_DATA_PORT = (LCD_DATA_PORT & ~LCD_DATA_MASK) | LCD_NIBBLE_HIGH(value);
+	Strobe();
+	LCD_DATA_PORT = (LCD_DATA_PORT & ~LCD_DATA_MASK) | LCD_NIBBLE_LOW(value);
+	Strobe();
+#else
+	LCD_DATA_PORT = value;
+	Strobe();
+	LCD_DATA_PORT = 0x00;
+#endif
+}
+
+/**
+ * @brief     Ecrit une commande de synchronisation en une seule impulsion EN
+ * @details   En interface 4 bits, seul le quartet haut de la commande est écrit
+ *
+ * @param     [in]    command   Commande à écrire
+ */
+static void LCD_BusWriteInit(const uint8_t command)
+{
+#if defined(LCD_INTERFACE_4BITS)
+	LCD_CONTROL_PORT &= ~_BV(LCD_CONTROL_RS_PIN);	// (RS off)
+	LCD_DATA_PORT = (LCD_DATA_PORT & ~LCD_DATA_MASK) | LCD_NIBBLE_HIGH(command);
+	Strobe();
+#else
+	LCD_BusWrite(command, LCD_SEND_COMMAND);
+#endif
+}
+
+#endif /* _162C_PARALLEL_H_ */
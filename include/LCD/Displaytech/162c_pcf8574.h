@@ -0,0 +1,149 @@
+/*
+ * @file      162c_pcf8574.h
+ *
+ * @author    Zéro Cool
+ * @date      19/10/2026 09:20:48
+ * @brief     Transport I2C PCF8574 du driver pour afficheur LCD de la série 162c
+ *
+ * @details   Accès à l'afficheur au travers d'un expandeur I2C PCF8574 (module "backpack"),
+ *            en interface 4 bits. Fichier inclus par 162c_core.h, il fournit les fonctions
+ *            LCD_Busxxx utilisées par la couche commandes du driver.
+ *
+ *            Chaque quartet est transmis par deux octets (EN à l'état haut puis à l'état bas)
+ *            et chaque octet de l'afficheur par une seule transaction I2C de quatre octets.
+ *            Entre LCD_BusBegin() et LCD_BusEnd(), les octets successifs sont transmis dans la
+ *            même transaction.
+ *
+ * @ingroup   LCD
+ */
+
+#ifndef _162C_PCF8574_H_
+#define _162C_PCF8574_H_
+
+#include <I2C_master.h>
+#if defined(LCD_ASYNC)
+#  include <util/atomic.h>
+#endif
+
+// Le temps de transfert des deux octets séparant deux fronts descendants de EN (18 bits)
+// doit couvrir le temps d'exécution d'une commande (42 µs) : 45 µs à 400 kHz
+#if SCL_CLOCK > 400000L
+#  error "LCD_TRANSPORT_PCF8574 requiert SCL_CLOCK inférieure ou égale à 400 kHz"
+#endif
+
+// Un seul afficheur par PCF8574
+#define LCD_BusSelect(display)
+
+// La durée d'une écriture couvre le temps d'exécution d'une instruction courte
+#define LCD_BUS_SELF_TIMED
+
+// Au-delà de 391 kHz, les 18 bits ne couvrent pas l'écriture d'une donnée (46 µs) : complément en µs
+#if SCL_CLOCK * 46L > 18000000L
+#  define LCD_BUS_DATA_DELAY_US   (46 - 18 * 1000000.0 / SCL_CLOCK)
+#endif
+
+// Etat du rétroéclairage, recopié dans chaque octet envoyé au PCF8574
+static uint8_t LCD_pcf_backlight = LCD_PCF8574_BL;
+
+// Positionné lorsqu'une transaction I2C est ouverte par LCD_BusBegin()
+static uint8_t LCD_pcf_open;
+
+/**
+ * @brief     Ouvre une transaction I2C regroupant les écritures suivantes
+ */
+static void LCD_BusBegin(void)
+{
+	I2C_Start(LCD_PCF8574_ADDRESS + TW_WRITE);
+	LCD_pcf_open = 1;
+}
+
+/**
+ * @brief     Termine la transaction I2C ouverte par LCD_BusBegin()
+ */
+static void LCD_BusEnd(void)
+{
+	I2C_Stop();
+	LCD_pcf_open = 0;
+}
+
+/**
+ * @brief     Transmet un quartet avec une impulsion EN
+ *
+ * @param     [in]    pins      Etat des broches du PCF8574 (EN à l'état bas)
+ */
+static void LCD_PcfNibble(const uint8_t pins)
+{
+	I2C_Send(pins | LCD_PCF8574_EN);
+	I2C_Send(pins);
+}
+
+/**
+ * @brief     Initialise le bus I2C et l'état des broches du PCF8574
+ */
+static void LCD_BusInitialize(void)
+{
+	I2C_Initialize();
+
+	LCD_BusBegin();
+	I2C_Send(LCD_pcf_backlight);
+	LCD_BusEnd();
+}
+
+/**
+ * @brief     Ecrit un octet sur le bus de l'afficheur
+ *
+ * @param     [in]    value     Commande ou caractère à écrire
+ * @param     [in]    flags     Combinaison de LCD_SEND_xxx
+ */
+static void LCD_BusWrite(const uint8_t value, const uint8_t flags)
+{
+	uint8_t pins = LCD_pcf_backlight;
+
+	if (flags & LCD_SEND_DATA)
+	{
+		pins |= LCD_PCF8574_RS;
+	}
+
+	if (!LCD_pcf_open)
+	{
+		I2C_Start(LCD_PCF8574_ADDRESS + TW_WRITE);
+	}
+
+	LCD_PcfNibble(pins | (value & 0xF0));
+	LCD_PcfNibble(pins | (uint8_t)(value << 4));
+
+	if (!LCD_pcf_open)
+	{
+		I2C_Stop();
+	}
+}
+
+/**
+ * @brief     Ecrit une commande de synchronisation en une seule impulsion EN
+ * @details   Seul le quartet haut de la commande est écrit
+ *
+ * @param     [in]    command   Commande à écrire
+ */
+static void LCD_BusWriteInit(const uint8_t command)
+{
+	LCD_BusBegin();
+	LCD_PcfNibble(LCD_pcf_backlight | (command & 0xF0));
+	LCD_BusEnd();
+}
+
+void LCD_SetBacklight(const uint8_t on)
+{
+	LCD_pcf_backlight = on ? LCD_PCF8574_BL : 0;
+
+#if defined(LCD_ASYNC)
+	// L'interruption utilise également le bus I2C
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+#endif
+	{
+		LCD_BusBegin();
+		I2C_Send(LCD_pcf_backlight);
+		LCD_BusEnd();
+	}
+}
+
+#endif /* _162C_PCF8574_H_ */
@@ -0,0 +1,275 @@
+/*
+ * @file      162c_pinmap.h
+ *
+ * @author    Zéro Cool
+ * @date      19/10/2026 09:36:30
+ * @brief     Transport broche à broche du driver pour afficheur LCD de la série 162c
+ *
+ * @details   Accès à l'afficheur au travers de broches quelconques, réparties sur plusieurs
+ *            PORT (interface 8 bits ou 4 bits). Fichier inclus par 162c_core.h, il fournit les
+ *            fonctions LCD_Busxxx utilisées par la couche commandes du driver.
+ *
+ *            Chaque broche est définie par une paire PORT, bit (par exemple B, 3 pour PB3),
+ *            résolue à la compilation : chaque accès à une broche est une instruction sbi, cbi,
+ *            sbic ou sbis (PORT A à G), sans aucune table parcourue à l'exécution.
+ *
+ * @ingroup   LCD
+ */
+
+#ifndef _162C_PINMAP_H_
+#define _162C_PINMAP_H_
+
+// Le busy flag n'est lisible que si la broche R/W est pilotée
+#if defined(LCD_PIN_RW)
+#  define LCD_HAS_BUSY_FLAG
+#endif
+
+// Décomposition d'une paire PORT, bit
+#define LCD_PINMAP_PORT_(port, bit)   PORT ## port
+#define LCD_PINMAP_DDR_(port, bit)    DDR ## port
+#define LCD_PINMAP_PIN_(port, bit)    PIN ## port
+#define LCD_PINMAP_BIT_(port, bit)    bit
+
+// Niveau supplémentaire : la paire, déjà développée en deux arguments lorsqu'elle est transmise
+// d'une macro à l'autre, est découpée
+#define LCD_PINMAP_PORT(...)          LCD_PINMAP_PORT_(__VA_ARGS__)
+#define LCD_PINMAP_DDR(...)           LCD_PINMAP_DDR_(__VA_ARGS__)
+#define LCD_PINMAP_PIN(...)           LCD_PINMAP_PIN_(__VA_ARGS__)
+#define LCD_PINMAP_BIT(...)           LCD_PINMAP_BIT_(__VA_ARGS__)
+
+// Accès à une broche
+#define LCD_PinHigh(...)              LCD_PINMAP_PORT(__VA_ARGS__) |=  _BV(LCD_PINMAP_BIT(__VA_ARGS__))
+#define LCD_PinLow(...)               LCD_PINMAP_PORT(__VA_ARGS__) &= ~_BV(LCD_PINMAP_BIT(__VA_ARGS__))
+#define LCD_PinOutput(...)            LCD_PINMAP_DDR(__VA_ARGS__)  |=  _BV(LCD_PINMAP_BIT(__VA_ARGS__))
+#define LCD_PinInput(...)             LCD_PINMAP_DDR(__VA_ARGS__)  &= ~_BV(LCD_PINMAP_BIT(__VA_ARGS__))
+#define LCD_PinRead(...)              (LCD_PINMAP_PIN(__VA_ARGS__) & _BV(LCD_PINMAP_BIT(__VA_ARGS__)))
+#define LCD_PinWrite(pin, value)      do { if (value) { LCD_PinHigh(pin); } else { LCD_PinLow(pin); } } while (0)
+
+// Les écritures sont indépendantes : pas de transaction à ouvrir
+#define LCD_BusBegin()
+#define LCD_BusEnd()
+#define LCD_BusSelect(display)
+
+// Pull-up sur DB7, actif pendant les lectures du busy flag : busy flag lu à 1 tant que
+// l'afficheur ne pilote pas le bus
+#define LCD_BusPullUp()               LCD_PinHigh(LCD_PIN_D7)
+
+/**
+ * @brief     Place les broches data en sortie ou en entrée
+ *
+ * @param     [in]    output    Non nul pour placer les broches en sortie
+ */
+static void LCD_PinmapDirection(const uint8_t output)
+{
+	if (output)
+	{
+#if !defined(LCD_INTERFACE_4BITS)
+		LCD_PinOutput(LCD_PIN_D0);
+		LCD_PinOutput(LCD_PIN_D1);
+		LCD_PinOutput(LCD_PIN_D2);
+		LCD_PinOutput(LCD_PIN_D3);
+#endif
+		LCD_PinOutput(LCD_PIN_D4);
+		LCD_PinOutput(LCD_PIN_D5);
+		LCD_PinOutput(LCD_PIN_D6);
+		LCD_PinOutput(LCD_PIN_D7);
+	}
+	else
+	{
+#if !defined(LCD_INTERFACE_4BITS)
+		LCD_PinInput(LCD_PIN_D0);
+		LCD_PinInput(LCD_PIN_D1);
+		LCD_PinInput(LCD_PIN_D2);
+		LCD_PinInput(LCD_PIN_D3);
+#endif
+		LCD_PinInput(LCD_PIN_D4);
+		LCD_PinInput(LCD_PIN_D5);
+		LCD_PinInput(LCD_PIN_D6);
+		LCD_PinInput(LCD_PIN_D7);
+	}
+}
+
+static void Strobe(void)
+{
+	LCD_PinHigh(LCD_PIN_EN);
+	__asm__("NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;");
+	__asm__("NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;");
+	LCD_PinLow(LCD_PIN_EN);
+}
+
+/**
+ * @brief     Présente les bits 4 à 7 d'un octet sur DB4..DB7
+ */
+static void LCD_PinmapHigh(const uint8_t value)
+{
+	LCD_PinWrite(LCD_PIN_D4, value & 0x10);
+	LCD_PinWrite(LCD_PIN_D5, value & 0x20);
+	LCD_PinWrite(LCD_PIN_D6, value & 0x40);
+	LCD_PinWrite(LCD_PIN_D7, value & 0x80);
+}
+
+#if defined(LCD_READBACK)
+
+/**
+ * @brief     Lit DB4..DB7 dans les bits 4 à 7 d'un octet
+ */
+static uint8_t LCD_PinmapReadHigh(void)
+{
+	uint8_t value = 0;
+
+	if (LCD_PinRead(LCD_PIN_D4)) value |= 0x10;
+	if (LCD_PinRead(LCD_PIN_D5)) value |= 0x20;
+	if (LCD_PinRead(LCD_PIN_D6)) value |= 0x40;
+	if (LCD_PinRead(LCD_PIN_D7)) value |= 0x80;
+
+	return value;
+}
+
+#endif
+
+/**
+ * @brief     Configure les broches de l'afficheur
+ */
+static void LCD_BusInitialize(void)
+{
+	LCD_PinOutput(LCD_PIN_EN);
+	LCD_PinOutput(LCD_PIN_RS);
+#if defined(LCD_PIN_RW)
+	LCD_PinOutput(LCD_PIN_RW);
+#endif
+	LCD_PinmapDirection(1);
+}
+
+#if defined(LCD_HAS_BUSY_FLAG)
+
+/**
+ * @brief     Attend que l'afficheur soit prêt
+ * @details   Lit le busy flag (BF) jusqu'à ce qu'il retombe, au plus tries fois
+ *
+ * @param     [in]    tries     Nombre maximal de lectures du busy flag
+ *
+ * @return    0 si l'afficheur est prêt, une valeur non nulle s'il est toujours occupé
+ */
+static uint8_t LCD_BusWaitReady(uint16_t tries)
+{
+	uint8_t status;
+
+	// Toutes les broches data en entrée : l'afficheur pilote le bus
+	LCD_PinmapDirection(0);
+
+	LCD_PinLow(LCD_PIN_RS);
+	LCD_PinHigh(LCD_PIN_RW);
+
+	while (1)
+	{
+		// Le busy flag est présenté sur DB7 tant que EN est maintenu à l'état haut
+		LCD_PinHigh(LCD_PIN_EN);
+		_delay_us(1);
+		status = LCD_PinRead(LCD_PIN_D7);
+		LCD_PinLow(LCD_PIN_EN);
+#if defined(LCD_INTERFACE_4BITS)
+		// Le quartet bas (compteur d'adresse) doit être lu pour terminer la lecture
+		_delay_us(1);
+		Strobe();
+#endif
+
+		if (!status || !--tries)
+		{
+			break;
+		}
+		_delay_us(1);
+	}
+
+	LCD_PinLow(LCD_PIN_RW);
+
+	LCD_PinmapDirection(1);
+
+	return status;
+}
+
+#endif
+
+#if defined(LCD_READBACK)
+
+/**
+ * @brief     Lit un octet de la mémoire de l'afficheur (DDRAM ou CGRAM)
+ * @details   Le compteur d'adresse de l'afficheur avance (ou recule) après la lecture
+ *
+ * @return    Octet lu à l'adresse courante
+ */
+static uint8_t LCD_BusRead(void)
+{
+	uint8_t value;
+
+	LCD_PinmapDirection(0);
+
+	LCD_PinHigh(LCD_PIN_RS);
+	LCD_PinHigh(LCD_PIN_RW);
+
+	LCD_PinHigh(LCD_PIN_EN);
+	_delay_us(1);
+	value = LCD_PinmapReadHigh();
+#if defined(LCD_INTERFACE_4BITS)
+	LCD_PinLow(LCD_PIN_EN);
+	_delay_us(1);
+	LCD_PinHigh(LCD_PIN_EN);
+	_delay_us(1);
+	value |= LCD_PinmapReadHigh() >> 4;
+#else
+	if (LCD_PinRead(LCD_PIN_D0)) value |= 0x01;
+	if (LCD_PinRead(LCD_PIN_D1)) value |= 0x02;
+	if (LCD_PinRead(LCD_PIN_D2)) value |= 0x04;
+	if (LCD_PinRead(LCD_PIN_D3)) value |= 0x08;
+#endif
+	LCD_PinLow(LCD_PIN_EN);
+
+	LCD_PinLow(LCD_PIN_RW);
+
+	LCD_PinmapDirection(1);
+
+	return value;
+}
+
+#endif
+
+/**
+ * @brief     Ecrit un octet sur le bus de l'afficheur
+ *
+ * @param     [in]    value     Commande ou caractère à écrire
+ * @param     [in]    flags     Combinaison de LCD_SEND_xxx
+ */
+static void LCD_BusWrite(const uint8_t value, const uint8_t flags)
+{
+	LCD_PinWrite(LCD_PIN_RS, flags & LCD_SEND_DATA);
+
+	LCD_PinmapHigh(value);
+#if defined(LCD_INTERFACE_4BITS)
+	Strobe();
+	LCD_PinmapHigh(value << 4);
+#else
+	LCD_PinWrite(LCD_PIN_D0, value & 0x01);
+	LCD_PinWrite(LCD_PIN_D1, value & 0x02);
+	LCD_PinWrite(LCD_PIN_D2, value & 0x04);
+	LCD_PinWrite(LCD_PIN_D3, value & 0x08);
+#endif
+	Strobe();
+}
+
+/**
+ * @brief     Ecrit une commande de synchronisation en une seule impulsion EN
+ * @details   En interface 4 bits, seul le quartet haut de la commande est écrit
+ *
+ * @param     [in]    command   Commande à écrire
+ */
+static void LCD_BusWriteInit(const uint8_t command)
+{
+#if defined(LCD_INTERFACE_4BITS)
+	LCD_PinLow(LCD_PIN_RS);
+	LCD_PinmapHigh(command);
+	Strobe();
+#else
+	LCD_BusWrite(command, LCD_SEND_COMMAND);
+#endif
+}
+
+#endif /* _162C_PINMAP_H_ */
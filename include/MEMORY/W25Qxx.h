@@ -0,0 +1,259 @@
+/**
+ * @file      W25Qxx.h
+ *
+ * @author    Zéro Cool
+ * @date      19/10/2026 09:08:41
+ * @brief     Driver pour les mémoires flash SPI NOR de la série W25Qxx
+ *
+ * @details   Fichier Driver permettant de gérer les mémoires flash SPI NOR compatibles
+ *            JEDEC de la série Winbond W25Qxx (W25Q16, W25Q32, W25Q64, W25Q128, ...).
+ *            Le driver s'appuie sur le bus partagé de SPI_master.h.
+ *
+ * La datasheet du composant W25Q64 est disponible [ici](https://www.winbond.com/resource-files/w25q64fv%20revq%2006142016.pdf).
+ *
+ * @note      La mémoire est organisée en pages de 256 octets, secteurs de 4 Ko et blocs de 64 Ko.
+ *            Une écriture ne peut que passer des bits de 1 à 0 : la zone doit être effacée
+ *            au préalable.
+ *
+ * @note      Les opérations d'écriture et d'effacement sont non bloquantes : elles démarrent
+ *            l'opération et rendent la main. La fin de l'opération est à tester avec
+ *            W25Q_IsBusy() ou à attendre avec W25Q_WaitReady(). Une opération demandée
+ *            alors que la mémoire est occupée retourne W25Q_STATUS_BUSY.
+ *
+ * Exemple d'utilisation :
+ * @code
+
+#include <avr/io.h>
+
+#define SPI_DDR                 DDRB
+#define SPI_PORT                PORTB
+#define SPI_MOSI_PIN            PINB3
+#define SPI_MISO_PIN            PINB4
+#define SPI_SCK_PIN             PINB5
+#define SPI_SS_PIN              PINB2
+
+#define W25Q_CS_DDR             DDRB
+#define W25Q_CS_PORT            PORTB
+#define W25Q_CS_PIN             PINB1
+
+#include <MEMORY/W25Qxx.h>
+
+int main(void)
+{
+    uint8_t id[3];
+    uint8_t data[300];
+
+    W25Q_Initialize();
+
+    // Lecture de l'identifiant JEDEC (0xEF 0x40 0x17 pour une W25Q64)
+    W25Q_ReadJedecId(id);
+
+    // Effacement du premier secteur de 4 Ko
+    W25Q_EraseSector(0x000000);
+    W25Q_WaitReady();
+
+    // Ecriture de 300 octets (découpée automatiquement sur les frontières de pages)
+    W25Q_Write(0x000080, data, sizeof(data));
+    W25Q_WaitReady();
+
+    // Relecture
+    W25Q_Read(0x000080, data, sizeof(data));
+
+    while(1)
+    {
+    }
+}
+
+ * @endcode
+ *
+ * @ingroup   MEMORY
+ */
+
+#ifndef _W25QXX_H_
+#define _W25QXX_H_
+
+#if !defined(W25Q_CS_DDR)
+#  error "W25Qxx.h requires W25Q_CS_DDR to be defined"
+#endif
+
+#if !defined(W25Q_CS_PORT)
+#  error "W25Qxx.h requires W25Q_CS_PORT to be defined"
+#endif
+
+#if !defined(W25Q_CS_PIN)
+#  error "W25Qxx.h requires W25Q_CS_PIN to be defined"
+#endif
+
+/**
+ * @brief     Diviseur d'horloge SPI de la mémoire (fck/2 par défaut)
+ */
+#if !defined(W25Q_SPI_CLOCK)
+#  define W25Q_SPI_CLOCK          SPI_CLOCK_DIV_2
+#endif
+
+#include <stdint.h>
+#include <SPI_master.h>
+
+/**
+ * @brief     Taille d'une page programmable en une commande
+ */
+#define W25Q_PAGE_SIZE            256
+
+/**
+ * @brief     Codes retour des fonctions du driver
+ * @details   Enumération des codes retour possibles du driver W25Qxx
+ */
+typedef enum
+{
+  W25Q_STATUS_OK                = 1,  /**< Succès */
+  W25Q_STATUS_BUSY              = 2,  /**< La mémoire est occupée par une écriture ou un effacement */
+  W25Q_STATUS_INVALID           = 3   /**< Argument non valide */
+} W25Q_STATUS;
+
+/**
+ * @brief       Initialise la mémoire flash
+ *
+ * @note        Cette fonction initialise également l'interface SPI
+ */
+void W25Q_Initialize(void);
+
+/**
+ * @brief       Lit l'identifiant JEDEC de la mémoire
+ *
+ * @param       [out]    id         Tableau de 3 octets : fabricant, type mémoire et capacité
+ */
+void W25Q_ReadJedecId(uint8_t id[3]);
+
+/**
+ * @brief       Indique si la mémoire est occupée
+ * @details     Lit le bit BUSY du registre de statut 1
+ *
+ * @return      Valeur indiquant si une écriture ou un effacement est en cours
+ *
+ * @retval      0x00   Mémoire disponible
+ * @retval      0x01   Mémoire occupée
+ */
+uint8_t W25Q_IsBusy(void);
+
+/**
+ * @brief       Attend que la mémoire soit disponible
+ * @details     Le registre de statut est lu en continu dans une seule transaction SPI
+ */
+void W25Q_WaitReady(void);
+
+/**
+ * @brief       Lit une zone de la mémoire
+ * @details     Lecture par la commande FAST_READ. La lecture n'est pas limitée aux
+ *              frontières de pages ou de secteurs.
+ *
+ * @param       [in]     address    Adresse de début de lecture
+ * @param       [out]    buffer     Buffer où stocker les octets lus
+ * @param       [in]     length     Nombre d'octets à lire
+ *
+ * @return      W25Q_STATUS_OK ou W25Q_STATUS_BUSY si la mémoire est occupée
+ */
+W25Q_STATUS W25Q_Read(uint32_t address, uint8_t * buffer, uint16_t length);
+
+/**
+ * @brief       Démarre une lecture en continu
+ * @details     Envoie la commande FAST_READ et laisse la mémoire sélectionnée. Les octets
+ *              sont ensuite lus par W25Q_ReadStream(), autant de fois que nécessaire,
+ *              puis la lecture est terminée par W25Q_ReadEnd().
+ *
+ * @param       [in]     address    Adresse de début de lecture
+ *
+ * @return      W25Q_STATUS_OK ou W25Q_STATUS_BUSY si la mémoire est occupée (la lecture
+ *              n'est alors pas démarrée)
+ *
+ * @warning     Aucun autre périphérique du bus SPI ne doit être utilisé avant l'appel à
+ *              W25Q_ReadEnd().
+ *
+ * Exemple :
+ * @code
+ * uint8_t block[32];
+ *
+ * if (W25Q_ReadBegin(0x010000) == W25Q_STATUS_OK)
+ * {
+ *     for (uint16_t i = 0; i < 1024; i++)
+ *     {
+ *         W25Q_ReadStream(block, sizeof(block));
+ *         // Traitement du bloc...
+ *     }
+ *     W25Q_ReadEnd();
+ * }
+ * @endcode
+ */
+W25Q_STATUS W25Q_ReadBegin(uint32_t address);
+
+/**
+ * @brief       Lit les octets suivants d'une lecture en continu
+ *
+ * @param       [out]    buffer     Buffer où stocker les octets lus
+ * @param       [in]     length     Nombre d'octets à lire
+ */
+void W25Q_ReadStream(uint8_t * buffer, uint16_t length);
+
+/**
+ * @brief       Termine une lecture en continu
+ */
+void W25Q_ReadEnd(void);
+
+/**
+ * @brief       Programme une page
+ * @details     Démarre la programmation d'au plus une page (commande PAGE_PROGRAM).
+ *              La fonction rend la main sans attendre la fin de la programmation.
+ *
+ * @param       [in]     address    Adresse de début d'écriture
+ * @param       [in]     buffer     Octets à écrire
+ * @param       [in]     length     Nombre d'octets à écrire
+ *
+ * @return      W25Q_STATUS_OK, W25Q_STATUS_BUSY si la mémoire est occupée ou
+ *              W25Q_STATUS_INVALID si l'écriture dépasse la fin de la page
+ */
+W25Q_STATUS W25Q_PageProgram(uint32_t address, const uint8_t * buffer, uint16_t length);
+
+/**
+ * @brief       Ecrit une zone de la mémoire
+ * @details     L'écriture est découpée automatiquement sur les frontières de pages.
+ *              La fonction attend la fin de chaque page avant de programmer la suivante
+ *              et rend la main dès le démarrage de la programmation de la dernière page.
+ *
+ * @param       [in]     address    Adresse de début d'écriture
+ * @param       [in]     buffer     Octets à écrire
+ * @param       [in]     length     Nombre d'octets à écrire
+ *
+ * @return      W25Q_STATUS_OK ou W25Q_STATUS_BUSY si la mémoire est occupée (rien n'est écrit)
+ */
+W25Q_STATUS W25Q_Write(uint32_t address, const uint8_t * buffer, uint16_t length);
+
+/**
+ * @brief       Efface un secteur de 4 Ko
+ * @details     La fonction rend la main sans attendre la fin de l'effacement.
+ *
+ * @param       [in]     address    Adresse contenue dans le secteur à effacer
+ *
+ * @return      W25Q_STATUS_OK ou W25Q_STATUS_BUSY si la mémoire est occupée
+ */
+W25Q_STATUS W25Q_EraseSector(uint32_t address);
+
+/**
+ * @brief       Efface un bloc de 64 Ko
+ * @details     La fonction rend la main sans attendre la fin de l'effacement.
+ *
+ * @param       [in]     address    Adresse contenue dans le bloc à effacer
+ *
+ * @return      W25Q_STATUS_OK ou W25Q_STATUS_BUSY si la mémoire est occupée
+ */
+W25Q_STATUS W25Q_EraseBlock(uint32_t address);
+
+/**
+ * @brief       Efface toute la mémoire
+ * @details     La fonction rend la main sans attendre la fin de l'effacement.
+ *
+ * @return      W25Q_STATUS_OK ou W25Q_STATUS_BUSY si la mémoire est occupée
+ */
+W25Q_STATUS W25Q_EraseChip(void);
+
+#include <MEMORY/W25Qxx_core.h>
+
+#endif /* _W25QXX_H_ */
@@ -0,0 +1,233 @@
+/*
+ * @file      W25Qxx_core.h
+ *
+ * @author    Zéro Cool
+ * @date      19/10/2026 09:08:41
+ * @brief     Core Driver pour les mémoires flash SPI NOR de la série W25Qxx
+ *
+ * @details   Fichier coeur du driver permettant de gérer les mémoires flash SPI NOR
+ *            compatibles JEDEC de la série Winbond W25Qxx
+ *
+ * @ingroup   MEMORY
+ */
+
+#ifndef _W25QXX_CORE_H_
+#define _W25QXX_CORE_H_
+
+// Liste des commandes
+#define W25Q_CMD_WRITE_ENABLE     0x06
+#define W25Q_CMD_READ_STATUS1     0x05
+#define W25Q_CMD_PAGE_PROGRAM     0x02
+#define W25Q_CMD_FAST_READ        0x0B
+#define W25Q_CMD_SECTOR_ERASE     0x20
+#define W25Q_CMD_BLOCK_ERASE      0xD8
+#define W25Q_CMD_CHIP_ERASE       0xC7
+#define W25Q_CMD_JEDEC_ID         0x9F
+
+// Masque du bit BUSY du registre de statut 1
+#define W25Q_MSK_BUSY             0x01
+
+/**
+ * @brief     Périphérique SPI de la mémoire
+ */
+static const SPI_DEVICE W25Q_spi = SPI_DEVICE_INIT(W25Q_CS_PORT, W25Q_CS_PIN, SPI_MODE_0, W25Q_SPI_CLOCK);
+
+/**
+ * @brief     Envoie une commande suivie d'une adresse sur 24 bits
+ *
+ * @note      La mémoire doit être sélectionnée
+ */
+static void W25Q_SendCommand(const uint8_t command, const uint32_t address)
+{
+  uint8_t frame[4];
+
+  frame[0] = command;
+  frame[1] = (address >> 16) & 0xFF;
+  frame[2] = (address >> 8) & 0xFF;
+  frame[3] = address & 0xFF;
+  SPI_SendBuffer(frame, sizeof(frame));
+}
+
+/**
+ * @brief     Envoie la commande WRITE_ENABLE, nécessaire avant toute écriture ou effacement
+ */
+static void W25Q_WriteEnable(void)
+{
+  SPI_SelectDevice(&W25Q_spi);
+  SPI_SendByte(W25Q_CMD_WRITE_ENABLE);
+  SPI_DeselectDevice(&W25Q_spi);
+}
+
+/**
+ * @brief     Démarre une commande d'effacement
+ */
+static W25Q_STATUS W25Q_Erase(const uint8_t command, const uint32_t address)
+{
+  if (W25Q_IsBusy())
+  {
+    return W25Q_STATUS_BUSY;
+  }
+
+  W25Q_WriteEnable();
+
+  SPI_SelectDevice(&W25Q_spi);
+  W25Q_SendCommand(command, address);
+  SPI_DeselectDevice(&W25Q_spi);
+
+  return W25Q_STATUS_OK;
+}
+
+void W25Q_Initialize(void)
+{
+  SPI_Initialize();
+
+  W25Q_CS_DDR |= _BV(W25Q_CS_PIN);    // Chip select en sortie
+  SPI_DeselectDevice(&W25Q_spi);
+}
+
+void W25Q_ReadJedecId(uint8_t id[3])
+{
+  SPI_SelectDevice(&W25Q_spi);
+  SPI_SendByte(W25Q_CMD_JEDEC_ID);
+  SPI_ReceiveBuffer(id, 3);
+  SPI_DeselectDevice(&W25Q_spi);
+}
+
+uint8_t W25Q_IsBusy(void)
+{
+  uint8_t status;
+
+  SPI_SelectDevice(&W25Q_spi);
+  SPI_SendByte(W25Q_CMD_READ_STATUS1);
+  status = SPI_SendByte(0xFF);
+  SPI_DeselectDevice(&W25Q_spi);
+
+  return (status & W25Q_MSK_BUSY) ? 1 : 0;
+}
+
+void W25Q_WaitReady(void)
+{
+  SPI_SelectDevice(&W25Q_spi);
+  SPI_SendByte(W25Q_CMD_READ_STATUS1);
+  // Le registre de statut est renvoyé en continu tant que la mémoire est sélectionnée
+  while (SPI_SendByte(0xFF) & W25Q_MSK_BUSY);
+  SPI_DeselectDevice(&W25Q_spi);
+}
+
+W25Q_STATUS W25Q_ReadBegin(uint32_t address)
+{
+  if (W25Q_IsBusy())
+  {
+    return W25Q_STATUS_BUSY;
+  }
+
+  SPI_SelectDevice(&W25Q_spi);
+  W25Q_SendCommand(W25Q_CMD_FAST_READ, address);
+  // Octet factice imposé par la commande FAST_READ
+  SPI_SendByte(0xFF);
+
+  return W25Q_STATUS_OK;
+}
+
+void W25Q_ReadStream(uint8_t * buffer, uint16_t length)
+{
+  SPI_ReceiveBuffer(buffer, length);
+}
+
+void W25Q_ReadEnd(void)
+{
+  SPI_DeselectDevice(&W25Q_spi);
+}
+
+W25Q_STATUS W25Q_Read(uint32_t address, uint8_t * buffer, uint16_t length)
+{
+  W25Q_STATUS status = W25Q_ReadBegin(address);
+
+  if (status != W25Q_STATUS_OK)
+  {
+    return status;
+  }
+
+  W25Q_ReadStream(buffer, length);
+  W25Q_ReadEnd();
+
+  return W25Q_STATUS_OK;
+}
+
+W25Q_STATUS W25Q_PageProgram(uint32_t address, const uint8_t * buffer, uint16_t length)
+{
+  // Au delà de la fin de page, la mémoire reboucle sur le début de la page
+  if (length == 0 || (address % W25Q_PAGE_SIZE) + length > W25Q_PAGE_SIZE)
+  {
+    return W25Q_STATUS_INVALID;
+  }
+
+  if (W25Q_IsBusy())
+  {
+    return W25Q_STATUS_BUSY;
+  }
+
+  W25Q_WriteEnable();
+
+  SPI_SelectDevice(&W25Q_spi);
+  W25Q_SendCommand(W25Q_CMD_PAGE_PROGRAM, address);
+  SPI_SendBuffer(buffer, length);
+  SPI_DeselectDevice(&W25Q_spi);
+
+  return W25Q_STATUS_OK;
+}
+
+W25Q_STATUS W25Q_Write(uint32_t address, const uint8_t * buffer, uint16_t length)
+{
+  if (W25Q_IsBusy())
+  {
+    return W25Q_STATUS_BUSY;
+  }
+
+  while (length > 0)
+  {
+    // Nombre d'octets restants jusqu'à la fin de la page courante
+    uint16_t count = W25Q_PAGE_SIZE - (address % W25Q_PAGE_SIZE);
+    if (count > length)
+    {
+      count = length;
+    }
+
+    W25Q_WaitReady();
+    W25Q_PageProgram(address, buffer, count);
+
+    address += count;
+    buffer  += count;
+    length  -= count;
+  }
+
+  return W25Q_STATUS_OK;
+}
+
+W25Q_STATUS W25Q_EraseSector(uint32_t address)
+{
+  return W25Q_Erase(W25Q_CMD_SECTOR_ERASE, address);
+}
+
+W25Q_STATUS W25Q_EraseBlock(uint32_t address)
+{
+  return W25Q_Erase(W25Q_CMD_BLOCK_ERASE, address);
+}
+
+W25Q_STATUS W25Q_EraseChip(void)
+{
+  if (W25Q_IsBusy())
+  {
+    return W25Q_STATUS_BUSY;
+  }
+
+  W25Q_WriteEnable();
+
+  SPI_SelectDevice(&W25Q_spi);
+  SPI_SendByte(W25Q_CMD_CHIP_ERASE);
+  SPI_DeselectDevice(&W25Q_spi);
+
+  return W25Q_STATUS_OK;
+}
+
+#endif /* _W25QXX_CORE_H_ */
@@ -9,6 +9,12 @@
  *
  * @warning   API non finalisée non opérationnelle.
  *
+ * @note      Le module est piloté via le bus partagé de SPI_master.h. Seule sa broche
+ *            chip-select (ALPHA_SPI_SS_PIN sur ALPHA_SPI_PORT) lui est propre, ce qui
+ *            permet de le faire cohabiter avec d'autres périphériques SPI (MFRC522, ...).
+ *            La configuration du bus (SPI_DDR, SPI_PORT, SPI_MOSI_PIN, ...) est celle
+ *            attendue par SPI_master.h.
+ *
  * @todo Faire fonctionner l'API
  *
  * @ingroup   RFM
@@ -17,6 +23,28 @@
 #ifndef _ALPHA_H_
 #define _ALPHA_H_
 
+#if !defined(ALPHA_SPI_DIR)
+#  error "alpha.h requires ALPHA_SPI_DIR to be defined"
+#endif
+
+#if !defined(ALPHA_SPI_PORT)
+#  error "alpha.h requires ALPHA_SPI_PORT to be defined"
+#endif
+
+#if !defined(ALPHA_SPI_SS_PIN)
+#  error "alpha.h requires ALPHA_SPI_SS_PIN to be defined"
+#endif
+
+/**
+ * @brief     Diviseur d'horloge SPI du module alpha (fck/4 par défaut, soit 2MHz à 8MHz)
+ */
+#if !defined(ALPHA_SPI_CLOCK)
+#  define ALPHA_SPI_CLOCK         SPI_CLOCK_DIV_4
+#endif
+
+#include <stdint.h>
+#include <SPI_master.h>
+
 void ALPHA_TxInit(void);
 void ALPHA_RxInit(void);
 void ALPHA_SendData(uint8_t data);
@@ -8,40 +8,34 @@
 #ifndef _ALPHA_CORE_H_
 #define _ALPHA_CORE_H_
 
-void SPI_Init(void)
-{
-	ALPHA_SPI_DIR |=  _BV(ALPHA_SPI_MOSI_PIN);	// MOSI Output
-	ALPHA_SPI_DIR |=  _BV(ALPHA_SPI_SCK_PIN);	// Clock Output
-	ALPHA_SPI_DIR |=  _BV(ALPHA_SPI_SS_PIN);	// Slave Select Output
-	ALPHA_SPI_DIR &= ~_BV(ALPHA_SPI_MISO_PIN);	// MISO Input
-
-	ALPHA_SPI_PORT |=  _BV(ALPHA_SPI_MISO_PIN);	// Pull-up MISO
+#include <util/delay.h>
 
-	//SPCR = _BV(SPE)|_BV(MSTR)|_BV(SPR0);		// TODO : Pour le moment SPI activé en hardware
-	SPCR = _BV(SPE)|_BV(MSTR);		// IDem que la ligne du dessus, mais en 2MHz
-}
+/**
+ * @brief     Périphérique SPI du module alpha
+ */
+static const SPI_DEVICE ALPHA_spi = SPI_DEVICE_INIT(ALPHA_SPI_PORT, ALPHA_SPI_SS_PIN, SPI_MODE_0, ALPHA_SPI_CLOCK);
 
-void SPI_SendWord(uint16_t data)
+void ALPHA_SPIInit(void)
 {
-	ALPHA_SPI_PORT &= ~_BV(ALPHA_SPI_SS_PIN);	// SS to low
-
-	SPDR = data>>8;
-	while(!(SPSR & _BV(SPIF)));
+	SPI_Initialize();
 
-	SPDR = data & 0xFF;
-	while(!(SPSR & _BV(SPIF)));
-
-	ALPHA_SPI_PORT |= _BV(ALPHA_SPI_SS_PIN);	// SS to high
+	ALPHA_SPI_DIR |=  _BV(ALPHA_SPI_SS_PIN);	// Slave Select Output
+	SPI_DeselectDevice(&ALPHA_spi);
 }
 
-void SPI_SendByte(uint8_t data)
+void ALPHA_SendWord(uint16_t data)
 {
-	ALPHA_SPI_PORT &= ~_BV(ALPHA_SPI_SS_PIN);	// SS to low
-
-	SPDR = data;
-	while(!(SPSR & _BV(SPIF)));
+	SPI_SelectDevice(&ALPHA_spi);
+	SPI_SendByte(data >> 8);
+	SPI_SendByte(data & 0xFF);
+	SPI_DeselectDevice(&ALPHA_spi);
+}
 
-	ALPHA_SPI_PORT |= _BV(ALPHA_SPI_SS_PIN);	// SS to high
+void ALPHA_SendByte(uint8_t data)
+{
+	SPI_SelectDevice(&ALPHA_spi);
+	SPI_SendByte(data);
+	SPI_DeselectDevice(&ALPHA_spi);
 }
 
 void ALPHA_RxInit(void)
@@ -52,7 +46,7 @@ void ALPHA_RxInit(void)
 	ALPHA_FFS_DIR   &= ~_BV(ALPHA_FFS_PIN);		// FSK Input
 	ALPHA_FFS_PORT  |=  _BV(ALPHA_FFS_PIN);		// FSK Pull-up
 
-	SPI_Init();
+	ALPHA_SPIInit();
 
 	// Configuration Setting Command
 	// -----------------------------
@@ -64,7 +58,7 @@ void ALPHA_RxInit(void)
 	//   x3 x2 x1 x0 : Crystal Load Capacitance (1000 => 12.5 pF)
 	//   i2 i1 i0    : Baseband Bandwith (101 => 134 KHz)
 	//   dc          : Disable the clock Output
-	SPI_SendWord(0b1000100110001011);
+	ALPHA_SendWord(0b1000100110001011);
 
 	// Frequency Setting Command
 	// -------------------------
@@ -74,7 +68,7 @@ void ALPHA_RxInit(void)
 	// Fo = 10 MHz * (43 + F / 4000)    => Fo = 433.92 MHz
 	//
 	// NOTE : Configure Frequency BEFORE starting Synthesizer
-	SPI_SendWord(0b1010011000100000);
+	ALPHA_SendWord(0b1010011000100000);
 
 	// Receiver Setting Command
 	// ------------------------
@@ -85,7 +79,7 @@ void ALPHA_RxInit(void)
 	//   en       : Enable whole receiver chain (wake-up & low battery detector are not affected by this setting)
 	//
 	// RSSIth = RSSIsetth + Glna => RSSIth = -103 + LNA Gain
-	SPI_SendWord(0b1100000011000001);
+	ALPHA_SendWord(0b1100000011000001);
 
 	// Wake-Up Timer Command
 	// ---------------------
@@ -96,14 +90,14 @@ void ALPHA_RxInit(void)
 	// T = M * 2^R => 0ms
 	//
 	// NOTE : For continual operation, bit et must be cleared and set
-	//SPI_SendWord(0b1110000000000000);
+	//ALPHA_SendWord(0b1110000000000000);
 
 	// Low Duty-Cycle Command
 	// ----------------------
 	//   11001100             : Command
 	//   d6 d5 d4 d3 d2 d1 d0 : (0000111 => 7)
 	//   en                   : Enable low duty cycle mode
-	SPI_SendWord(0b1100110000001110);	// Low Duty-Cycle Command : DutyCycle = (D * 2 + 1) / M * 100%; en = 0
+	ALPHA_SendWord(0b1100110000001110);	// Low Duty-Cycle Command : DutyCycle = (D * 2 + 1) / M * 100%; en = 0
 
 	// Low Battery Detector & Microcontroller Clock Divider Command
 	// ------------------------------------------------------------
@@ -112,7 +106,7 @@ void ALPHA_RxInit(void)
 	//   t4 t3 t2 t1 t0 : Threshold voltage
 	//
 	// Vlowbat = 2.2 + T * 0.1 => Vlowbat = 2.2 V
-	SPI_SendWord(0b1100001011100000);
+	ALPHA_SendWord(0b1100001011100000);
 
 	// AFC Command
 	// -----------
@@ -123,7 +117,7 @@ void ALPHA_RxInit(void)
 	//   fi       : Enable high accuracy mode. The processing time is about 4 times longer
 	//   oe       : Enable the output (frequency offset) register
 	//   en       : Enable calculation of the offset frequency by the AFC circuit (if allows the addition of the content of the output register to the frequency control word of the PPL)
-	SPI_SendWord(0b1100011011110111);
+	ALPHA_SendWord(0b1100011011110111);
 
 	// Data Filter Command
 	// -------------------
@@ -133,7 +127,7 @@ void ALPHA_RxInit(void)
 	//   1        : -
 	//   s1 s0    : Type of data Filter (01 => Digital filter)
 	//   f2 f1 f0 : DQD threchold (100 => 4)
-	SPI_SendWord(0b1100010011101100);
+	ALPHA_SendWord(0b1100010011101100);
 
 	// Data Rate Command
 	// -----------------
@@ -144,7 +138,7 @@ void ALPHA_RxInit(void)
 	// BaudRate = 10 MHz / 29 / (DataRate + 1) / (1 + cs * 7) => BaudRate = 9578,5440613026819923371647509579 bauds
 	//
 	// Set the Receiver DataRate according the next function : DataRate = (10 MHz / 29 / (1 + cs * 7) / BaudRate) - 1
-	SPI_SendWord(0b1100100000100011);
+	ALPHA_SendWord(0b1100100000100011);
 
 	// Output and FIFO mode Command
 	// ----------------------------
@@ -157,16 +151,16 @@ void ALPHA_RxInit(void)
 	// NOTE : Synchron word is 2DD4h
 	// NOTE : To restart the synchron word reception, bit ff should be cleared and set. This action will initialize the FIFO and clear its content.
 	// NOTE : Bit fe modifies the function of pin 3 and pin 4. Pin 3 (nFFS) will become input if fe is set to 1. If the chip is used in FIFO mode, do not allow this to be a floating input.
-	SPI_SendWord(0b1100111010001000);
-	DELAI_US(250);
-	SPI_SendWord(0b1100111010001011);
-	DELAI_US(250);
+	ALPHA_SendWord(0b1100111010001000);
+	_delay_us(250);
+	ALPHA_SendWord(0b1100111010001011);
+	_delay_us(250);
 
 	// Reset Mode
 	// ----------
 	//   110110100000000 : Command
 	//   dr              : Disable the higly sensitive RESET mode. If this bit is cleared, a 600mV glitch in the power supply may cause a system reset.
-	SPI_SendWord(0b1101101000000001);
+	ALPHA_SendWord(0b1101101000000001);
 }
 
 ISR(PCINT0_vect)
@@ -194,7 +188,7 @@ void ALPHA_TxInit(void)
 	PCICR |= _BV(0);    //  Pin Change Interrupt Enable 0
 	PCMSK0 = _BV(6);    //  PCINT6 = PB6 pour la FFIT
 
-	SPI_Init();
+	ALPHA_SPIInit();
 
 	//// Configuration Setting Command
 	//// -----------------------------
@@ -211,7 +205,7 @@ void ALPHA_TxInit(void)
 	////   Fo   : Channel center Frequency (Cf. Frequency Setting Command)
 	////   M    : binary number m2 m1 m0 (In range from 0 to 6)
 	////   sign : ms XOR FSKinput
-	//SPI_SendWord(0b1000111110000000);
+	//ALPHA_SendWord(0b1000111110000000);
 	//
 	//// Frequency Setting Command
 	//// -------------------------
@@ -221,7 +215,7 @@ void ALPHA_TxInit(void)
 	//// Fo = 10 MHz * (43 + F / 4000)    => Fo = 433.92 MHz
 	////
 	//// NOTE : Configure Frequency BEFORE starting Synthesizer
-	//SPI_SendWord(0b1010011000100000);
+	//ALPHA_SendWord(0b1010011000100000);
 	//
 	//// Data Rate Command
 	//// -----------------
@@ -229,14 +223,14 @@ void ALPHA_TxInit(void)
 	////   r7 r6 r5 r4 r3 r2 r1 r0 : DataRate (00100011 => 35)
 	////
 	//// BaudRate = 10 MHz / 29 / (DataRate + 1) => BaudRate = 9578,5440613026819923371647509579 bauds
-	//SPI_SendWord(0b1100100000100011);
+	//ALPHA_SendWord(0b1100100000100011);
 	//
 	//// Power Setting Command
 	//// ---------------------
 	////   1011     : Command
 	////   0        : ook (non dispo sur Alpha-TX433)
 	////   p2 p1 p0 : Relative Output Power (dB) (000 => 0 dB)
-	//SPI_SendByte(0b10110000);
+	//ALPHA_SendByte(0b10110000);
 	//
 	//// Low Battery Detector & Tx bit Synchronization Command
 	//// -----------------------------------------------------
@@ -247,7 +241,7 @@ void ALPHA_TxInit(void)
 	////   t4 t3 t2 t1 t0 : Threshold voltage
 	////
 	//// Vlowbat = 2.2 + T * 0.1 => Vlowbat = 2.2 V
-	//SPI_SendWord(0b1100001000100000);
+	//ALPHA_SendWord(0b1100001000100000);
 	//
 	//// Sleep Command
 	//// -------------
@@ -257,7 +251,7 @@ void ALPHA_TxInit(void)
 	//// The effect of this command depends on the Power Management Command. It immediately disable the power amplifier (if a0=1 and ea=0) and
 	//// the synthesizer (if a1=1 and es=0). Stops the crystal oscillator after S periods of the microcontroller clock (if a1=1 and ex=0) to enable
 	//// the microcontroller to execute all necessary commands before entering sleep mode itself.
-	////SPI_SendWord(0b1100010000010000);
+	////ALPHA_SendWord(0b1100010000010000);
 	//
 	//// Wake-Up Timer Command
 	//// ---------------------
@@ -268,7 +262,7 @@ void ALPHA_TxInit(void)
 	//// T = M * 2^R => 0ms
 	////
 	//// NOTE : For continual operation, bit et must be cleared and set
-	////SPI_SendWord(0b1110000000000000);
+	////ALPHA_SendWord(0b1110000000000000);
 	//
 	//// Power Management Command
 	//// ------------------------
@@ -287,7 +281,7 @@ void ALPHA_TxInit(void)
 	////   To enable the automatic internal control of the crystal oscillator, the synthesizer and the power amplifier, the corresponding bits (ex, es, ea) must be zero.
 	////   The ex bit should be set for the correct control os es and ea. The oscillator can be switched off by clearing the ex bit after the transmission.
 	////   The Sleep Command can be used to indicate the end of the data transmission process, because the Data Transmit Command does not contain the length of the TX data.
-	//SPI_SendWord(0b1100000000111001);
+	//ALPHA_SendWord(0b1100000000111001);
 }
 
 void ALPHA_SendFSK(uint8_t data)
@@ -310,11 +304,11 @@ void ALPHA_SendFSK(uint8_t data)
 
 void ALPHA_SendData(uint8_t data)
 {
-	SPI_SendWord(0b1100000000110001);	// Power Management Command - extinction de l'amplificateur
-	DELAI_US(250);
-	SPI_SendWord(0b1100000000111001);	// Power Management Command - allumage amplificateur (Tx_Open)
-	DELAI_US(250);		// Wait PLL startup time
-	DELAI_MS(5);		// Wait crystal oscillator startup time
+	ALPHA_SendWord(0b1100000000110001);	// Power Management Command - extinction de l'amplificateur
+	_delay_us(250);
+	ALPHA_SendWord(0b1100000000111001);	// Power Management Command - allumage amplificateur (Tx_Open)
+	_delay_us(250);		// Wait PLL startup time
+	_delay_ms(5);		// Wait crystal oscillator startup time
 
 	uint8_t checksum = ~data;
 
@@ -326,7 +320,7 @@ void ALPHA_SendData(uint8_t data)
 	ALPHA_SendFSK(checksum);	// checksum
 	ALPHA_SendFSK(0xAA);	// dummy
 
-	SPI_SendWord(0b1100000000110001);	// Power Management Command - extinction de l'amplificateur
+	ALPHA_SendWord(0b1100000000110001);	// Power Management Command - extinction de l'amplificateur
 }
 
 #endif /* _ALPHA_CORE_H_ */
@@ -95,10 +95,105 @@
  * SPI MOSI   MOSI           SPI_MOSI_PIN
  * SPI MISO   MISO           SPI_MISO_PIN
  * SPI SCK    SCK            SPI_SCK_PIN
+ * IRQ        IRQ            MFRC522_IRQ_PIN (optionnelle)
  *
  * @warning   La broche RST (ou Reset) doit se trouver sur le même port que la
  *            broche SPI_SS_PIN
  *
+ * @note      Par défaut, la fin de chaque commande (échange avec un PICC, calcul de CRC)
+ *            est détectée en lisant en boucle les registres ComIrqReg ou DivIrqReg, soit une
+ *            transaction SPI toutes les 17.86us pendant toute la durée de l'échange (jusqu'à
+ *            25ms sans réponse du PICC). La définition de MFRC522_IRQ_PIN (avec
+ *            MFRC522_IRQ_DDR, MFRC522_IRQ_PORT et MFRC522_IRQ_INPUT) relie la broche IRQ du
+ *            MFRC522 au driver : les bits attendus sont activés dans ComIEnReg ou DivIEnReg
+ *            (sortie IRQ en push-pull, active à l'état bas) et le driver attend le changement
+ *            d'état de la broche, sans aucune transaction SPI. Le bus SPI reste libre pour les
+ *            autres périphériques (dans les interruptions).@n
+ *            Avec MFRC522_IRQ_SLEEP, le CPU est endormi (sleep_cpu(), mode choisi par
+ *            l'application avec set_sleep_mode()) pendant l'attente. Le réveil nécessite une
+ *            interruption sur la broche IRQ (INTx ou PCINTx) configurée par l'application ; si
+ *            MFRC522_IRQ_vect est définie, le driver définit lui-même l'interruption
+ *            correspondante (vide) :
+ * @code
+ * #define MFRC522_IRQ_DDR         DDRD
+ * #define MFRC522_IRQ_PORT        PORTD
+ * #define MFRC522_IRQ_INPUT       PIND
+ * #define MFRC522_IRQ_PIN         PIND2
+ * #define MFRC522_IRQ_SLEEP
+ * #define MFRC522_IRQ_vect        INT0_vect
+ *
+ * #include <RFID/MFRC522.h>
+ *
+ * // INT0 sur front descendant (réveil depuis le mode IDLE)
+ * EICRA = (EICRA & ~_BV(ISC00)) | _BV(ISC01);
+ * EIMSK |= _BV(INT0);
+ * set_sleep_mode(SLEEP_MODE_IDLE);
+ * sei();
+ *
+ * MFRC522_PCD_Init();
+ * @endcode
+ *
+ * @warning   Avec MFRC522_IRQ_SLEEP, l'attente n'est bornée que par le timer du MFRC522 (25ms)
+ *            et par le nombre de réveils du CPU : les interruptions doivent être actives et un
+ *            MFRC522 qui ne répond plus n'est détecté que si d'autres interruptions réveillent
+ *            le CPU.
+ *
+ * @note      La définition de MFRC522_ASYNC ajoute une API non bloquante pour les opérations
+ *            MFRC522_PICC_RequestA(), MFRC522_PICC_WakeupA(), MFRC522_PICC_Select(),
+ *            MFRC522_MIFARE_Authenticate() et MFRC522_MIFARE_Read() : la fonction *Start()
+ *            correspondante lance l'opération et rend la main immédiatement, puis
+ *            MFRC522_PCD_AsyncPoll() la fait progresser (une lecture de ComIrqReg ou DivIrqReg, ou
+ *            de la seule broche IRQ avec MFRC522_IRQ_PIN, tant que la commande en cours n'est pas
+ *            terminée) et retourne MFRC522_STATUS_BUSY jusqu'à son résultat. Sans MFRC522_HW_CRC,
+ *            les calculs de CRC_A sont des étapes de l'opération : MFRC522_PCD_AsyncPoll() n'attend
+ *            jamais. Une seule opération peut être en cours.@n
+ *            Avec MFRC522_IRQ_PIN et MFRC522_IRQ_vect, l'interruption définie par le driver
+ *            appelle elle-même MFRC522_PCD_AsyncPoll() à chaque front de la broche IRQ (fin d'une
+ *            commande ou d'un calcul de CRC_A) : l'opération progresse sans intervention de la
+ *            boucle principale, qui n'a plus qu'à consulter le résultat :
+ * @code
+ * #define MFRC522_ASYNC
+ *
+ * #include <RFID/MFRC522.h>
+ *
+ * MFRC522_PICC_UID uid;
+ *
+ * MFRC522_PCD_Init();
+ * MFRC522_PICC_RequestAStart(&uid);
+ *
+ * while (1)
+ * {
+ *   MFRC522_STATUS status = MFRC522_PCD_AsyncPoll();
+ *   if (status != MFRC522_STATUS_BUSY)
+ *   {
+ *     if (status == MFRC522_STATUS_OK)
+ *     {
+ *       // Carte présente...
+ *     }
+ *     // Nouvelle recherche
+ *     MFRC522_PICC_RequestAStart(&uid);
+ *   }
+ *
+ *   // Autres traitements (radio, afficheur...)
+ * }
+ * @endcode
+ *
+ * @note      La définition de MFRC522_HW_CRC confie le CRC_A au MFRC522 lui-même (bits TxCRCEn et
+ *            RxCRCEn des registres TxModeReg et RxModeReg) : il est ajouté aux trames émises et
+ *            contrôlé sur les trames reçues au fil de l'eau, sans les deux commandes CalcCRC (et leurs
+ *            attentes) par échange. Le CRC_A n'est alors plus présent dans les buffers :
+ *            MFRC522_MIFARE_Read() retourne 16 octets au lieu de 18. MFRC522_CRC_SIZE donne le nombre
+ *            d'octets de CRC_A présents dans les buffers (0 ou 2).@n
+ *            Les trames sans CRC_A (REQA, WUPA, anticollision, MFAuthent, réponses ACK/NAK MIFARE)
+ *            sont échangées avec TxCRCEn et RxCRCEn désactivés.
+ *
+ * @warning   Avec MFRC522_ASYNC, les fonctions bloquantes ne doivent pas être appelées pendant une
+ *            opération asynchrone. Si MFRC522_PCD_AsyncPoll() est appelée depuis une interruption,
+ *            le bus SPI ne doit pas être utilisé par la boucle principale pendant l'opération.@n
+ *            Avec MFRC522_IRQ_PIN, un MFRC522 qui ne répond plus ne produit plus de front sur la
+ *            broche IRQ : l'application doit borner l'opération elle-même avec
+ *            MFRC522_PCD_AsyncAbort().
+ *
  * @todo      Exemple d'utilisation à faire
  *
  * @ingroup   RFID
@@ -119,6 +214,41 @@
 #  error "SPI_master.h requires MFRC522_PORT to be defined"
 #endif
 
+#if defined(MFRC522_IRQ_PIN)
+#  if !defined(MFRC522_IRQ_DDR)
+#    error "MFRC522.h requires MFRC522_IRQ_DDR to be defined"
+#  endif
+
+#  if !defined(MFRC522_IRQ_PORT)
+#    error "MFRC522.h requires MFRC522_IRQ_PORT to be defined"
+#  endif
+
+#  if !defined(MFRC522_IRQ_INPUT)
+#    error "MFRC522.h requires MFRC522_IRQ_INPUT to be defined"
+#  endif
+#elif defined(MFRC522_IRQ_SLEEP) || defined(MFRC522_IRQ_vect)
+#  error "MFRC522_IRQ_SLEEP et MFRC522_IRQ_vect requièrent que MFRC522_IRQ_PIN soit définie"
+#endif
+
+/**
+ * @brief     Paramètre checkCRC : le CRC_A de la réponse est contrôlé
+ */
+#define MFRC522_CRC_RX           0x01
+
+/**
+ * @brief     Paramètre checkCRC : le CRC_A est ajouté à la trame émise par le MFRC522 (MFRC522_HW_CRC uniquement)
+ */
+#define MFRC522_CRC_TX           0x02
+
+/**
+ * @brief     Nombre d'octets de CRC_A présents dans les buffers émis et reçus
+ */
+#if defined(MFRC522_HW_CRC)
+#  define MFRC522_CRC_SIZE       0
+#else
+#  define MFRC522_CRC_SIZE       2
+#endif
+
 /**
  * @brief     Codes retour des fonctions de la bibliothèque
  * @details   Enumération des codes retous possibles de la bibliothèque MFRC522
@@ -135,7 +265,8 @@ typedef enum
   MFRC522_STATUS_CRC_WRONG      = 8,  /**< Le CRC_A ne correspond pas */
   MFRC522_STATUS_MIFARE_NACK    = 9,  /**< Une carte MIFARE a répondu par NAK */
   MFRC522_STATUS_PROPRIETARY_ANTICOLLISION = 10,   /**< Mode anticllision propriétaire */
-  MFRC522_STATUS_BCC_ERROR      = 11  /**< Erreur de contrôle de la valeur du BCC */
+  MFRC522_STATUS_BCC_ERROR      = 11, /**< Erreur de contrôle de la valeur du BCC */
+  MFRC522_STATUS_BUSY           = 12  /**< Opération asynchrone en cours */
 } MFRC522_STATUS;
 
 /**
@@ -274,9 +405,12 @@ MFRC522_STATUS MFRC522_PCD_PerformSelfTest(void);
  *                                  @li @c out : Nombre d'octets retournés
  * @param     [in,out]  validBits   Nombre de bits valids pour le dernier octets (0 à 8). NULL par défaut
  * @param     [in]      rxAlign     Définit la position du bit dans backData[0] pour le premier bit reçu. Par défaut 0.
- * @param     [in]      checkCRC    Valeurs possible :
+ * @param     [in]      checkCRC    Combinaison de :
  *                                  @li @c 0 -> Pas de contrôle CRC.
- *                                  @li @c 1 -> Les deux derniers octets sont considérés comme CRC_A et sont donc validés.
+ *                                  @li @c MFRC522_CRC_RX -> Le CRC_A de la réponse est validé (ses deux derniers
+ *                                      octets, ou par le MFRC522 avec MFRC522_HW_CRC).
+ *                                  @li @c MFRC522_CRC_TX -> Avec MFRC522_HW_CRC, le MFRC522 ajoute le CRC_A
+ *                                      à la trame. Sans effet sinon : le CRC_A doit être dans @c sendData.
  *
  * @warning   Aucun dépassement de capacité n'est testé.
  *
@@ -390,7 +524,8 @@ void MFRC522_MIFARE_StopCrypto1(void);
  *
  * @param     [in]      blockAddr   Adresse du bloc à lire
  * @param     [out]     buffer      Buffer où seront stocké les données lues
- * @param     [in,out]  bufferSize  Taille du buffer (doit être au moins de 18 octets). Le CRC_A est également retourné
+ * @param     [in,out]  bufferSize  Taille du buffer (doit être au moins de 18 octets). Le CRC_A est également retourné,
+ *                                  sauf avec MFRC522_HW_CRC (16 + MFRC522_CRC_SIZE octets)
  *
  * @warning   Aucun dépassement de capacité n'est testé.
  *
@@ -554,6 +689,113 @@ MFRC522_PICC_TYPE MFRC522_PICC_GetType(MFRC522_PICC_UID * uid);
  */
 void MFRC522_MIFARE_SetAccessBits(uint8_t * accessBitBuffer, uint8_t g0, uint8_t g1, uint8_t g2, uint8_t g3);
 
+#if defined(MFRC522_ASYNC)
+
+/////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous functions
+/////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     Lance une commande Request type A sans attendre la réponse du PICC
+ * @details   Version asynchrone de MFRC522_PICC_RequestA(). Le résultat est obtenu par
+ *            MFRC522_PCD_AsyncPoll().
+ *
+ * @param     [in,out]  uid         Pointeur sur une structure de type MFRC522_PICC_UID.@n
+ *                                  La zone ATQA est alimentée à la fin de l'opération
+ *
+ * @return    MFRC522_STATUS_OK si l'opération est lancée.
+ *            MFRC522_STATUS_BUSY si une opération asynchrone est déjà en cours.
+ */
+MFRC522_STATUS MFRC522_PICC_RequestAStart(MFRC522_PICC_UID * uid);
+
+/**
+ * @brief     Lance une commande Wakeup type A sans attendre la réponse du PICC
+ * @details   Version asynchrone de MFRC522_PICC_WakeupA(). Le résultat est obtenu par
+ *            MFRC522_PCD_AsyncPoll().
+ *
+ * @param     [in,out]  uid         Pointeur sur une structure de type MFRC522_PICC_UID.@n
+ *                                  La zone ATQA est alimentée à la fin de l'opération
+ *
+ * @return    MFRC522_STATUS_OK si l'opération est lancée.
+ *            MFRC522_STATUS_BUSY si une opération asynchrone est déjà en cours.
+ */
+MFRC522_STATUS MFRC522_PICC_WakeupAStart(MFRC522_PICC_UID * uid);
+
+/**
+ * @brief     Lance la sélection d'un PICC sans attendre ses réponses
+ * @details   Version asynchrone de MFRC522_PICC_Select() : l'anticollision et la sélection sont
+ *            enchaînées par MFRC522_PCD_AsyncPoll(), qui retourne le résultat.
+ *
+ * @param     [in,out]  uid         Pointeur sur une structure de type MFRC522_PICC_UID.@n
+ *                                  Alimenté à la fin de l'opération avec l'UID du PICC sélectionné.
+ *
+ * @return    MFRC522_STATUS_OK si l'opération est lancée.
+ *            MFRC522_STATUS_BUSY si une opération asynchrone est déjà en cours.
+ *            MFRC522_STATUS_* en cas d'erreur.
+ */
+MFRC522_STATUS MFRC522_PICC_SelectStart(MFRC522_PICC_UID * uid);
+
+/**
+ * @brief     Lance l'authentification MIFARE d'un bloc sans attendre la réponse du PICC
+ * @details   Version asynchrone de MFRC522_MIFARE_Authenticate(). Le résultat est obtenu par
+ *            MFRC522_PCD_AsyncPoll().
+ *
+ * @param     [in]      keytype        Type de clef à utiliser pour l'authentification
+ * @param     [in]      blockAddr      Adresse du bloc sur lequel s'authentifier
+ * @param     [in]      key            Clef à utiliser pour l'authentification
+ * @param     [in]      uid            Carte sur laquelle effectuer l'authentification
+ *
+ * @return    MFRC522_STATUS_OK si l'opération est lancée.
+ *            MFRC522_STATUS_BUSY si une opération asynchrone est déjà en cours.
+ *            MFRC522_STATUS_* en cas d'erreur.
+ */
+MFRC522_STATUS MFRC522_MIFARE_AuthenticateStart(MFRC522_AUTH_KEY keytype, uint8_t blockAddr, MFRC522_MIFARE_KEY * key, MFRC522_PICC_UID * uid);
+
+/**
+ * @brief     Lance la lecture de 16 octets (+2 CRC_A) du PICC ACTIF sans attendre sa réponse
+ * @details   Version asynchrone de MFRC522_MIFARE_Read(). Le résultat est obtenu par
+ *            MFRC522_PCD_AsyncPoll().
+ *
+ * @note      @c buffer et @c bufferSize doivent rester valides jusqu'à la fin de l'opération.
+ *
+ * @param     [in]      blockAddr   Adresse du bloc à lire
+ * @param     [out]     buffer      Buffer où seront stocké les données lues
+ * @param     [in,out]  bufferSize  Taille du buffer (doit être au moins de 18 octets). Le CRC_A est également retourné
+ *
+ * @return    MFRC522_STATUS_OK si l'opération est lancée.
+ *            MFRC522_STATUS_BUSY si une opération asynchrone est déjà en cours.
+ *            MFRC522_STATUS_* en cas d'erreur.
+ */
+MFRC522_STATUS MFRC522_MIFARE_ReadStart(uint8_t blockAddr, uint8_t * buffer, uint8_t * bufferSize);
+
+/**
+ * @brief     Fait progresser l'opération asynchrone en cours
+ * @details   Teste la fin de la commande ou du calcul de CRC_A en cours du MFRC522. Lorsqu'il est
+ *            terminé, son résultat est récupéré et l'étape suivante de l'opération est lancée. Aucun
+ *            appel n'attend le MFRC522.
+ *
+ * @note      Peut être appelée depuis la boucle principale ou depuis l'interruption de la broche
+ *            IRQ (un appel imbriqué retourne MFRC522_STATUS_BUSY sans rien faire).
+ *
+ * @note      Sans MFRC522_IRQ_PIN, chaque étape est arrêtée avec MFRC522_STATUS_TIMEOUT après 2000
+ *            appels sans fin de commande (5000 pour un calcul de CRC_A), soit les 35.7ms (89ms) des
+ *            fonctions bloquantes si les appels sont continus.
+ *
+ * @return    MFRC522_STATUS_BUSY tant que l'opération n'est pas terminée.
+ *            Le résultat de la dernière opération ensuite (MFRC522_STATUS_OK si tout va bien).
+ */
+MFRC522_STATUS MFRC522_PCD_AsyncPoll(void);
+
+/**
+ * @brief     Abandonne l'opération asynchrone en cours
+ * @details   Arrête la commande en cours du MFRC522. Le résultat de l'opération devient
+ *            MFRC522_STATUS_TIMEOUT. Permet à l'application d'appliquer son propre délai maximal,
+ *            indispensable avec MFRC522_IRQ_PIN.
+ */
+void MFRC522_PCD_AsyncAbort(void);
+
+#endif
+
 /*
 bool PICC_IsNewCardPresent();
 */
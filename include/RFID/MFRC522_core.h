@@ -19,6 +19,17 @@
 #include <util/delay.h>
 #include <SPI_master.h>
 
+#if defined(MFRC522_IRQ_SLEEP)
+#  include <avr/interrupt.h>
+#  include <avr/sleep.h>
+#elif defined(MFRC522_IRQ_vect)
+#  include <avr/interrupt.h>
+#endif
+
+#if defined(MFRC522_ASYNC)
+#  include <util/atomic.h>
+#endif
+
 /**
  * @brief     Registres sur MFRC522
  * @details   Enumération des registres disponibles du MFRC522 (Cf. Chapitre 9 de la datasheet)
@@ -348,6 +359,130 @@ void MFRC522_PCD_ClearRegisterBitMask(PCD_REG reg, uint8_t mask)
   MFRC522_PCD_WriteRegister(reg, tmp & (~mask));
 }
 
+#if defined(MFRC522_IRQ_PIN)
+
+/**
+ * @brief     Bit IRqInv du registre ComIEnReg : broche IRQ active à l'état bas
+ */
+#define MFRC522_IRQ_INVERT       0x80
+
+/**
+ * @brief     Bit IRQPushPull du registre DivIEnReg : broche IRQ en sortie push-pull
+ */
+#define MFRC522_IRQ_PUSHPULL     0x80
+
+/**
+ * @brief     Attend l'activation de la broche IRQ du MFRC522
+ * @details   La broche est lue toutes les 10us, ou à chaque réveil du CPU avec MFRC522_IRQ_SLEEP.
+ *            Aucune transaction SPI n'est faite pendant l'attente.
+ *
+ * @param     [in]    tries     Nombre maximal de lectures de la broche
+ *
+ * @return    1 si la broche IRQ est active, 0 en cas de timeout
+ */
+static uint8_t MFRC522_PCD_WaitIrq(uint16_t tries)
+{
+  while (MFRC522_IRQ_INPUT & _BV(MFRC522_IRQ_PIN))
+  {
+    if (--tries == 0)
+    {
+      return 0;
+    }
+
+#if defined(MFRC522_IRQ_SLEEP)
+    // La broche est relue interruptions masquées : si elle s'active avant la mise en sommeil,
+    // l'interruption reste en attente et réveille le CPU dès sleep_cpu() (sei() n'est effectif
+    // qu'après l'instruction suivante)
+    cli();
+    if (MFRC522_IRQ_INPUT & _BV(MFRC522_IRQ_PIN))
+    {
+      sleep_enable();
+      sei();
+      sleep_cpu();
+      sleep_disable();
+    }
+    sei();
+#else
+    _delay_us(10);
+#endif
+  }
+
+  return 1;
+}
+
+#  if defined(MFRC522_IRQ_vect) && !defined(MFRC522_ASYNC)
+// L'interruption ne sert qu'à réveiller le CPU, l'état de la broche IRQ est lu par MFRC522_PCD_WaitIrq()
+EMPTY_INTERRUPT(MFRC522_IRQ_vect);
+#  endif
+
+#endif
+
+/**
+ * @brief     Démarre le calcul du CRC_A d'un tableau par le coprocesseur du MFRC522
+ * @details   Première partie de MFRC522_PCD_CalculateCRC(). La fin du calcul est testée par
+ *            MFRC522_PCD_CalculateCRCCheck() et le résultat lu par MFRC522_PCD_CalculateCRCFinish().
+ *
+ * @param     [in]    data      Pointeur sur les données à transférer dans la FIFO pour calculer le CRC_A
+ * @param     [in]    length    Nombre d'octets à transférer
+ */
+static void MFRC522_PCD_CalculateCRCStart(uint8_t * data, uint8_t length)
+{
+  MFRC522_PCD_WriteRegister(PCD_REG_CommandReg, PCD_CMD_Idle);       // Arrêt de toute commande en cours
+  MFRC522_PCD_WriteRegister(PCD_REG_DivIrqReg, 0x04);                // Netoyage du bit d'intéruption CRCIRq
+  MFRC522_PCD_SetRegisterBitMask(PCD_REG_FIFOLevelReg, 0x80);        // FlushBuffer = 1, FIFO initialization
+  MFRC522_PCD_WriteRegisterArray(PCD_REG_FIFODataReg, length, data);      // Ecriture des données dans la FIFO
+#if defined(MFRC522_IRQ_PIN)
+  MFRC522_PCD_WriteRegister(PCD_REG_DivIEnReg, MFRC522_IRQ_PUSHPULL | 0x04);   // Broche IRQ activée par CRCIRq
+#endif
+  MFRC522_PCD_WriteRegister(PCD_REG_CommandReg, PCD_CMD_CalcCRC);    // Démarrage du calcul du CRC
+}
+
+/**
+ * @brief     Teste la fin du calcul lancé par MFRC522_PCD_CalculateCRCStart()
+ * @details   Avec MFRC522_IRQ_PIN, seule la broche IRQ est lue. Sinon, le registre DivIrqReg est
+ *            lu (17.73us).
+ *
+ * @return    MFRC522_STATUS_BUSY tant que le calcul n'est pas terminé.
+ *            MFRC522_STATUS_OK si le calcul est terminé.
+ */
+static MFRC522_STATUS MFRC522_PCD_CalculateCRCCheck(void)
+{
+#if defined(MFRC522_IRQ_PIN)
+  if (MFRC522_IRQ_INPUT & _BV(MFRC522_IRQ_PIN))
+  {
+    return MFRC522_STATUS_BUSY;
+  }
+#else
+  // DivIrqReg[7..0] bits are: Set2 reserved reserved MfinActIRq reserved CRCIRq reserved reserved
+  // Si le bit CRCIRq est positionné, c'est que le calcul du CRC est terminé
+  if (!(MFRC522_PCD_ReadRegister(PCD_REG_DivIrqReg) & 0x04))
+  {
+    return MFRC522_STATUS_BUSY;
+  }
+#endif
+
+  return MFRC522_STATUS_OK;
+}
+
+/**
+ * @brief     Récupère le résultat du calcul lancé par MFRC522_PCD_CalculateCRCStart()
+ *
+ * @param     [out]   result    Pointeur du résultat. Le résultat est écrit dans un entier non signé sur 16 bits, octet de poid faible en premier.
+ */
+static void MFRC522_PCD_CalculateCRCFinish(uint16_t * result)
+{
+#if defined(MFRC522_IRQ_PIN)
+  MFRC522_PCD_WriteRegister(PCD_REG_DivIEnReg, MFRC522_IRQ_PUSHPULL);
+#endif
+
+  // Arrêt du calcul du CRC
+  MFRC522_PCD_WriteRegister(PCD_REG_CommandReg, PCD_CMD_Idle);
+
+  // Transfert du réulstat du registre en sortie
+  *result  = MFRC522_PCD_ReadRegister(PCD_REG_CRCResultRegL) << 8;
+  *result |= MFRC522_PCD_ReadRegister(PCD_REG_CRCResultRegH);
+}
+
 /**
  * @brief     Calcul le CRC d'un tableau
  * @details   Utilise le coprocesseur du MFRC522 pour calculer le CRC_A
@@ -362,43 +497,99 @@ void MFRC522_PCD_ClearRegisterBitMask(PCD_REG reg, uint8_t mask)
  */
 MFRC522_STATUS MFRC522_PCD_CalculateCRC(uint8_t * data, uint8_t length, uint16_t * result)
 {
-  MFRC522_PCD_WriteRegister(PCD_REG_CommandReg, PCD_CMD_Idle);       // Arrêt de toute commande en cours
-  MFRC522_PCD_WriteRegister(PCD_REG_DivIrqReg, 0x04);                // Netoyage du bit d'intéruption CRCIRq
-  MFRC522_PCD_SetRegisterBitMask(PCD_REG_FIFOLevelReg, 0x80);        // FlushBuffer = 1, FIFO initialization
-  MFRC522_PCD_WriteRegisterArray(PCD_REG_FIFODataReg, length, data);      // Ecriture des données dans la FIFO
-  MFRC522_PCD_WriteRegister(PCD_REG_CommandReg, PCD_CMD_CalcCRC);    // Démarrage du calcul du CRC
+  MFRC522_PCD_CalculateCRCStart(data, length);
 
+#if defined(MFRC522_IRQ_PIN)
+  // Attente que le calcul du CRC soit terminé, sans transaction SPI (89ms au maximum)
+  if (!MFRC522_PCD_WaitIrq(8900))
+  {
+    MFRC522_PCD_WriteRegister(PCD_REG_DivIEnReg, MFRC522_IRQ_PUSHPULL);
+    return MFRC522_STATUS_TIMEOUT;
+  }
+#else
   // Attente que le calcul du CRC soit terminé. (Chaque itération prent 17.73us)
   uint16_t i = 5000;
-  uint8_t n;
-  while (1)
+  while (MFRC522_PCD_CalculateCRCCheck() == MFRC522_STATUS_BUSY)
   {
-    // DivIrqReg[7..0] bits are: Set2 reserved reserved MfinActIRq reserved CRCIRq reserved reserved
-    n = MFRC522_PCD_ReadRegister(PCD_REG_DivIrqReg);
-
-    // Si le bit CRCIRq est positionné, c'est que le calcul du CRC est terminé
-    if (n & 0x04)
-    {
-      break;
-    }
-
     // Timeout si le calcul est trop long (89ms environ)
     if (--i == 0)
     {
       return MFRC522_STATUS_TIMEOUT;
     }
   }
+#endif
 
-  // Arrêt du calcul du CRC
-  MFRC522_PCD_WriteRegister(PCD_REG_CommandReg, PCD_CMD_Idle);
+  MFRC522_PCD_CalculateCRCFinish(result);
 
-  // Transfert du réulstat du registre en sortie
-  *result  = MFRC522_PCD_ReadRegister(PCD_REG_CRCResultRegL) << 8;
-  *result |= MFRC522_PCD_ReadRegister(PCD_REG_CRCResultRegH);
+  return MFRC522_STATUS_OK;
+}
+
+/**
+ * @brief     Ajoute le CRC_A à une trame
+ * @details   Le CRC_A est calculé par MFRC522_PCD_CalculateCRC() et écrit en buffer[length] et
+ *            buffer[length + 1]. Avec MFRC522_HW_CRC, rien n'est fait : le MFRC522 l'ajoute à
+ *            l'émission (MFRC522_CRC_TX).
+ *
+ * @param     [in,out]  buffer    Trame, de taille au moins length + MFRC522_CRC_SIZE
+ * @param     [in]      length    Taille de la trame sans CRC_A
+ *
+ * @return    Status du traitement (MFRC522_STATUS_OK si tout va bien)
+ */
+static MFRC522_STATUS MFRC522_PCD_AppendCRC(uint8_t * buffer, uint8_t length)
+{
+#if defined(MFRC522_HW_CRC)
+  (void)buffer;
+  (void)length;
+#else
+  MFRC522_STATUS result;
+  uint16_t crc = 0x0000;
+
+  result = MFRC522_PCD_CalculateCRC(buffer, length, &crc);
+  if (result != MFRC522_STATUS_OK)
+  {
+    return result;
+  }
+  buffer[length]     = (crc & 0xFF00) >> 8;
+  buffer[length + 1] = crc & 0x00FF;
+#endif
 
   return MFRC522_STATUS_OK;
 }
 
+#if defined(MFRC522_HW_CRC)
+
+/**
+ * @brief     Bits TxCRCEn et RxCRCEn des registres TxModeReg et RxModeReg
+ */
+#define MFRC522_CRC_ENABLE       0x80
+
+/**
+ * @brief     Valeur programmée dans les registres TxModeReg et RxModeReg (combinaison de MFRC522_CRC_TX et MFRC522_CRC_RX)
+ */
+static uint8_t MFRC522_crc;
+
+/**
+ * @brief     Active ou désactive le CRC_A matériel pour le prochain échange
+ * @details   Les registres ne sont écrits que si leur valeur change : une suite de lectures ne coûte
+ *            aucune transaction SPI. Les autres bits de TxModeReg et RxModeReg (106kBd) restent à 0.
+ *
+ * @param     [in]    crc       Combinaison de MFRC522_CRC_TX et MFRC522_CRC_RX
+ */
+static void MFRC522_PCD_SetCRC(uint8_t crc)
+{
+  if ((crc ^ MFRC522_crc) & MFRC522_CRC_TX)
+  {
+    MFRC522_PCD_WriteRegister(PCD_REG_TxModeReg, (crc & MFRC522_CRC_TX) ? MFRC522_CRC_ENABLE : 0x00);
+  }
+  if ((crc ^ MFRC522_crc) & MFRC522_CRC_RX)
+  {
+    MFRC522_PCD_WriteRegister(PCD_REG_RxModeReg, (crc & MFRC522_CRC_RX) ? MFRC522_CRC_ENABLE : 0x00);
+  }
+  MFRC522_crc = crc;
+}
+
+#endif
+
 void MFRC522_PCD_Reset()
 {
   MFRC522_PCD_WriteRegister(PCD_REG_CommandReg, PCD_CMD_SoftReset);
@@ -407,6 +598,15 @@ void MFRC522_PCD_Reset()
   {
     // Le PCD est toujours en train de rebooter... Il faut attendre !
   }
+
+#if defined(MFRC522_IRQ_PIN)
+  // La réinitialisation repasse la broche IRQ en open drain
+  MFRC522_PCD_WriteRegister(PCD_REG_DivIEnReg, MFRC522_IRQ_PUSHPULL);
+#endif
+#if defined(MFRC522_HW_CRC)
+  // La réinitialisation désactive TxCRCEn et RxCRCEn
+  MFRC522_crc = 0;
+#endif
 }
 
 void MFRC522_PCD_AntennaOn()
@@ -432,12 +632,21 @@ void MFRC522_PCD_Init()
   // Broche Reset en sortie
   MFRC522_DDR |=  _BV(MFRC522_RESET_PIN);
 
+#if defined(MFRC522_IRQ_PIN)
+  // Broche IRQ en entrée avec pull-up (le MFRC522 la pilote en open drain jusqu'à sa configuration)
+  MFRC522_IRQ_DDR  &= ~_BV(MFRC522_IRQ_PIN);
+  MFRC522_IRQ_PORT |=  _BV(MFRC522_IRQ_PIN);
+#endif
+
   if (!(MFRC522_PORT & _BV(MFRC522_RESET_PIN)))
   {
     // Reset PIN to Hi
     MFRC522_PORT |=  _BV(MFRC522_RESET_PIN);
     // Attente de 37,4us le temps que le cristal ce mette en route (Cf. Section 8.8.2)
     _delay_us(37.74);
+#if defined(MFRC522_HW_CRC)
+    MFRC522_crc = 0;
+#endif
   }
   else
   {
@@ -457,6 +666,12 @@ void MFRC522_PCD_Init()
   MFRC522_PCD_WriteRegister(PCD_REG_TReloadRegH, 0x03);
   MFRC522_PCD_WriteRegister(PCD_REG_TReloadRegL, 0xE8);
 
+#if defined(MFRC522_IRQ_PIN)
+  // Broche IRQ en push-pull, active à l'état bas, aucune source activée
+  MFRC522_PCD_WriteRegister(PCD_REG_ComIEnReg, MFRC522_IRQ_INVERT);
+  MFRC522_PCD_WriteRegister(PCD_REG_DivIEnReg, MFRC522_IRQ_PUSHPULL);
+#endif
+
   // Default 0x00. Force a 100 % ASK modulation independent of the ModGsPReg register setting
   MFRC522_PCD_WriteRegister(PCD_REG_TxASKReg, 0x40);
   // Default 0x3F. Set the preset value for the CRC coprocessor for the CalcCRC command to 0x6363 (ISO 14443-3 part 6.2.4)
@@ -566,43 +781,22 @@ MFRC522_STATUS MFRC522_PCD_PerformSelfTest(void)
 /////////////////////////////////////////////////////////////////////////////////////
 
 /**
- * @brief     Exécute la commande de transfert dans la FIFO du MFRC522
- * @details   Exécute la commande PCD_CMD_Transceive qui envoi les données de la FIFO
- *            vers l'antenne
- *
- * @note      La validation CRC ne peut être faite que si @c backData et @c backLen sont spécifiés
+ * @brief     Démarre l'exécution d'une commande du MFRC522
+ * @details   Première partie de MFRC522_PCD_CommunicateWithPICC() : les données sont transférées
+ *            dans la FIFO et la commande est lancée. La fin de la commande est testée par
+ *            MFRC522_PCD_CommunicateCheck().
  *
  * @param     [in]      command     Commande à exécuter
  * @param     [in]      waitIrq     Mask de bit du registre PCD_REG_ComIrqReg signalant la bonne terminaison de la commande
  * @param     [in]      sendData    Pointeur des données à transférer dans la FIFO
  * @param     [in]      sendLen     Nombre d'octets à transférer dans la FIFO
- * @param     [out]     backData    NULL ou pointeur vers le buffer devant récupérer les données après transfert
- * @param     [in]      backLen     Valeurs possibles :
- *                                  @li @c in : Nombre max d'octets pouvant être écrit dans le buffer backData
- *                                  @li @c out : Nombre d'octets retournés
- * @param     [in,out]  validBits   Nombre de bits valids pour le dernier octets (0 à 8). NULL par défaut
- * @param     [in]      rxAlign     Définit la position du bit dans backData[0] pour le premier bit reçu. Par défaut 0.
- * @param     [in]      checkCRC    Valeurs possible :
- *                                  @li @c 0 -> Pas de contrôle CRC.
- *                                  @li @c 1 -> Les deux derniers octets sont considérés comme CRC_A et sont donc validés.
- *
- * @warning   Aucun dépassement de capacité n'est testé.
- *
- * @return    MFRC522_STATUS_OK si le test est OK.
- *            MFRC522_STATUS_* en cas d'erreur.
+ * @param     [in]      txLastBits  Nombre de bits valides du dernier octet envoyé (0 : octet complet)
+ * @param     [in]      rxAlign     Définit la position du bit dans backData[0] pour le premier bit reçu
+ * @param     [in]      checkCRC    Combinaison de MFRC522_CRC_TX et MFRC522_CRC_RX (CRC_A matériel avec MFRC522_HW_CRC)
  */
-MFRC522_STATUS MFRC522_PCD_CommunicateWithPICC(PCD_CMD command, uint8_t waitIrq, uint8_t * sendData, uint8_t sendLen, uint8_t * backData,
-  uint8_t * backLen, uint8_t * validBits, uint8_t rxAlign, uint8_t checkCRC)
+static void MFRC522_PCD_CommunicateStart(PCD_CMD command, uint8_t waitIrq, uint8_t * sendData, uint8_t sendLen,
+  uint8_t txLastBits, uint8_t rxAlign, uint8_t checkCRC)
 {
-  uint8_t n;
-  uint8_t _validBits = 0;
-
-  // Préparation des valeurs pour le registre PCD_REG_BitFramingReg
-  uint8_t txLastBits = 0;
-  if (validBits != NULL)
-  {
-    txLastBits = *validBits;
-  }
   // RxAlign    = BitFramingReg[6..4]
   // TxLastBits = BitFramingReg[2..0]
   uint8_t bitFraming = (rxAlign << 4) + txLastBits;
@@ -611,6 +805,17 @@ MFRC522_STATUS MFRC522_PCD_CommunicateWithPICC(PCD_CMD command, uint8_t waitIrq,
   MFRC522_PCD_WriteRegister(PCD_REG_CommandReg, PCD_CMD_Idle);
   // Clear all seven interrupt request bits
   MFRC522_PCD_WriteRegister(PCD_REG_ComIrqReg, 0x7F);
+#if defined(MFRC522_IRQ_PIN)
+  // Broche IRQ activée par les bits attendus et par le timer (TimerIRq)
+  MFRC522_PCD_WriteRegister(PCD_REG_ComIEnReg, MFRC522_IRQ_INVERT | waitIrq | 0x01);
+#else
+  (void)waitIrq;
+#endif
+#if defined(MFRC522_HW_CRC)
+  MFRC522_PCD_SetCRC(checkCRC);
+#else
+  (void)checkCRC;
+#endif
   // FlushBuffer = 1, FIFO initialization
   MFRC522_PCD_SetRegisterBitMask(PCD_REG_FIFOLevelReg, 0x80);
   // Write sendData to the FIFO
@@ -624,33 +829,130 @@ MFRC522_STATUS MFRC522_PCD_CommunicateWithPICC(PCD_CMD command, uint8_t waitIrq,
     // StartSend=1, transmission of data starts
     MFRC522_PCD_SetRegisterBitMask(PCD_REG_BitFramingReg, 0x80);
   }
+}
 
-  // Wait for the command to complete.
-  // In MFRC522_PCD_Init() we set the TAuto flag in TModeReg. This means the timer automatically starts when the PCD stops transmitting.
-  // Each iteration of the do-while-loop takes 17.86us.
-  uint16_t i = 2000;
-  while (1)
+/**
+ * @brief     Teste la fin de la commande lancée par MFRC522_PCD_CommunicateStart()
+ * @details   Avec MFRC522_IRQ_PIN, seule la broche IRQ est lue tant que la commande n'est pas
+ *            terminée. Sinon, le registre ComIrqReg est lu (17.86us).
+ *
+ * @param     [in]      waitIrq     Mask de bit du registre PCD_REG_ComIrqReg signalant la bonne terminaison de la commande
+ *
+ * @return    MFRC522_STATUS_BUSY tant que la commande n'est pas terminée.
+ *            MFRC522_STATUS_TIMEOUT si le timer du MFRC522 a expiré (rien reçu en 25ms).
+ *            MFRC522_STATUS_OK si la commande est terminée.
+ */
+static MFRC522_STATUS MFRC522_PCD_CommunicateCheck(uint8_t waitIrq)
+{
+#if defined(MFRC522_IRQ_PIN)
+  if (MFRC522_IRQ_INPUT & _BV(MFRC522_IRQ_PIN))
   {
-    // ComIrqReg[7..0] bits are: Set1 TxIRq RxIRq IdleIRq HiAlertIRq LoAlertIRq ErrIRq TimerIRq
-    n = MFRC522_PCD_ReadRegister(PCD_REG_ComIrqReg);
-    // One of the interrupts that signal success has been set.
-    if (n & waitIrq)
-    {
-      break;
-    }
-    // Timer interrupt - nothing received in 25ms
-    if (n & 0x01)
-    {
-      return MFRC522_STATUS_TIMEOUT;
-    }
-    // The emergency break. If all other condions fail we will eventually terminate on this one after 35.7ms.
-    // Communication with the MFRC522 might be down.
-    if (--i == 0)
-    {
-      return MFRC522_STATUS_TIMEOUT;
-    }
+    return MFRC522_STATUS_BUSY;
+  }
+  MFRC522_PCD_WriteRegister(PCD_REG_ComIEnReg, MFRC522_IRQ_INVERT);
+#endif
+
+  // ComIrqReg[7..0] bits are: Set1 TxIRq RxIRq IdleIRq HiAlertIRq LoAlertIRq ErrIRq TimerIRq
+  uint8_t n = MFRC522_PCD_ReadRegister(PCD_REG_ComIrqReg);
+  // One of the interrupts that signal success has been set.
+  if (n & waitIrq)
+  {
+    return MFRC522_STATUS_OK;
+  }
+#if defined(MFRC522_IRQ_PIN)
+  // Seul le timer a pu activer la broche IRQ
+  return MFRC522_STATUS_TIMEOUT;
+#else
+  // Timer interrupt - nothing received in 25ms
+  if (n & 0x01)
+  {
+    return MFRC522_STATUS_TIMEOUT;
+  }
+  return MFRC522_STATUS_BUSY;
+#endif
+}
+
+/**
+ * @brief     Contrôle la forme d'une réponse terminée par un CRC_A
+ *
+ * @param     [in]      length      Nombre d'octets reçus
+ * @param     [in]      validBits   Nombre de bits valides du dernier octet reçu (0 : octet complet)
+ *
+ * @return    MFRC522_STATUS_OK si le test est OK.
+ *            MFRC522_STATUS_MIFARE_NACK si le PICC a répondu par un NAK.
+ *            MFRC522_STATUS_CRC_WRONG si la réponse ne peut pas contenir de CRC_A.
+ */
+static MFRC522_STATUS MFRC522_PCD_CheckCRCFrame(uint8_t length, uint8_t validBits)
+{
+  // In this case a MIFARE Classic NAK is not OK.
+  if (length == 1 && validBits == 4)
+  {
+    return MFRC522_STATUS_MIFARE_NACK;
+  }
+
+  // We need at least the CRC_A value and all 8 bits of the last byte must be received.
+#if MFRC522_CRC_SIZE
+  if (length < MFRC522_CRC_SIZE || validBits != 0)
+#else
+  if (validBits != 0)
+#endif
+  {
+    return MFRC522_STATUS_CRC_WRONG;
+  }
+
+  return MFRC522_STATUS_OK;
+}
+
+#if !defined(MFRC522_HW_CRC)
+
+/**
+ * @brief     Compare le CRC_A reçu (deux derniers octets) au CRC_A calculé
+ *
+ * @param     [in]      data        Réponse reçue, CRC_A compris
+ * @param     [in]      length      Nombre d'octets de la réponse
+ * @param     [in]      crc         CRC_A calculé sur les length - 2 premiers octets
+ *
+ * @return    MFRC522_STATUS_OK si le CRC_A est valide.
+ *            MFRC522_STATUS_CRC_WRONG sinon.
+ */
+static MFRC522_STATUS MFRC522_PCD_CompareCRC(uint8_t * data, uint8_t length, uint16_t crc)
+{
+  if (   (data[length - 2] != ((crc & 0xFF00) >> 8))
+      || (data[length - 1] != (crc & 0xFF)))
+  {
+    return MFRC522_STATUS_CRC_WRONG;
   }
 
+  return MFRC522_STATUS_OK;
+}
+
+#endif
+
+/**
+ * @brief     Récupère le résultat d'une commande terminée
+ * @details   Dernière partie de MFRC522_PCD_CommunicateWithPICC() : contrôle des erreurs, lecture
+ *            de la FIFO et validation du CRC_A.
+ *
+ * @param     [out]     backData    NULL ou pointeur vers le buffer devant récupérer les données après transfert
+ * @param     [in]      backLen     Valeurs possibles :
+ *                                  @li @c in : Nombre max d'octets pouvant être écrit dans le buffer backData
+ *                                  @li @c out : Nombre d'octets retournés
+ * @param     [out]     validBits   NULL ou nombre de bits valides du dernier octet reçu (0 : octet complet)
+ * @param     [in]      rxAlign     Définit la position du bit dans backData[0] pour le premier bit reçu
+ * @param     [in]      checkCRC    Valeurs possible :
+ *                                  @li @c 0 -> Pas de contrôle CRC.
+ *                                  @li @c MFRC522_CRC_RX -> Les deux derniers octets sont considérés comme CRC_A et sont donc validés
+ *                                      (avec MFRC522_HW_CRC, le bit CRCErr du registre ErrorReg est testé).
+ *
+ * @return    MFRC522_STATUS_OK si le test est OK.
+ *            MFRC522_STATUS_* en cas d'erreur.
+ */
+static MFRC522_STATUS MFRC522_PCD_CommunicateFinish(uint8_t * backData, uint8_t * backLen, uint8_t * validBits,
+  uint8_t rxAlign, uint8_t checkCRC)
+{
+  uint8_t n;
+  uint8_t _validBits = 0;
+
   // Stop now if any errors except collisions were detected.
   // ErrorReg[7..0] bits are: WrErr TempErr reserved BufferOvfl CollErr CRCErr ParityErr ProtocolErr
   uint8_t errorRegValue = MFRC522_PCD_ReadRegister(PCD_REG_ErrorReg);
@@ -689,19 +991,22 @@ MFRC522_STATUS MFRC522_PCD_CommunicateWithPICC(PCD_CMD command, uint8_t waitIrq,
   }
 
   // Perform CRC_A validation if requested.
-  if (backData != NULL && backLen != NULL && checkCRC != 0)
+  if (backData != NULL && backLen != NULL && (checkCRC & MFRC522_CRC_RX))
   {
-    // In this case a MIFARE Classic NAK is not OK.
-    if (*backLen == 1 && _validBits == 4)
+    n = MFRC522_PCD_CheckCRCFrame(*backLen, _validBits);
+    if (n != MFRC522_STATUS_OK)
     {
-      return MFRC522_STATUS_MIFARE_NACK;
+      return n;
     }
 
-    // We need at least the CRC_A value and all 8 bits of the last byte must be received.
-    if (*backLen < 2 || _validBits != 0)
+#if defined(MFRC522_HW_CRC)
+    // CRC_A contrôlé par le MFRC522 pendant la réception, et retiré de la FIFO
+    if (errorRegValue & 0x04)
     {
+      // CRCErr
       return MFRC522_STATUS_CRC_WRONG;
     }
+#else
 
     // Verify CRC_A - do our own calculation and store the control in controlBuffer.
     uint16_t controlBuffer;
@@ -711,14 +1016,83 @@ MFRC522_STATUS MFRC522_PCD_CommunicateWithPICC(PCD_CMD command, uint8_t waitIrq,
       return n;
     }
 
-    if (   (backData[*backLen - 2] != ((controlBuffer & 0xFF00) >> 8))
-        || (backData[*backLen - 1] != (controlBuffer & 0xFF)))
+    return MFRC522_PCD_CompareCRC(backData, *backLen, controlBuffer);
+#endif
+  }
+
+  return MFRC522_STATUS_OK;
+}
+
+/**
+ * @brief     Exécute la commande de transfert dans la FIFO du MFRC522
+ * @details   Exécute la commande PCD_CMD_Transceive qui envoi les données de la FIFO
+ *            vers l'antenne
+ *
+ * @note      La validation CRC ne peut être faite que si @c backData et @c backLen sont spécifiés
+ *
+ * @param     [in]      command     Commande à exécuter
+ * @param     [in]      waitIrq     Mask de bit du registre PCD_REG_ComIrqReg signalant la bonne terminaison de la commande
+ * @param     [in]      sendData    Pointeur des données à transférer dans la FIFO
+ * @param     [in]      sendLen     Nombre d'octets à transférer dans la FIFO
+ * @param     [out]     backData    NULL ou pointeur vers le buffer devant récupérer les données après transfert
+ * @param     [in]      backLen     Valeurs possibles :
+ *                                  @li @c in : Nombre max d'octets pouvant être écrit dans le buffer backData
+ *                                  @li @c out : Nombre d'octets retournés
+ * @param     [in,out]  validBits   Nombre de bits valids pour le dernier octets (0 à 8). NULL par défaut
+ * @param     [in]      rxAlign     Définit la position du bit dans backData[0] pour le premier bit reçu. Par défaut 0.
+ * @param     [in]      checkCRC    Combinaison de :
+ *                                  @li @c 0 -> Pas de contrôle CRC.
+ *                                  @li @c MFRC522_CRC_RX -> Le CRC_A de la réponse est validé.
+ *                                  @li @c MFRC522_CRC_TX -> Avec MFRC522_HW_CRC, le MFRC522 ajoute le CRC_A à la trame.
+ *
+ * @warning   Aucun dépassement de capacité n'est testé.
+ *
+ * @return    MFRC522_STATUS_OK si le test est OK.
+ *            MFRC522_STATUS_* en cas d'erreur.
+ */
+MFRC522_STATUS MFRC522_PCD_CommunicateWithPICC(PCD_CMD command, uint8_t waitIrq, uint8_t * sendData, uint8_t sendLen, uint8_t * backData,
+  uint8_t * backLen, uint8_t * validBits, uint8_t rxAlign, uint8_t checkCRC)
+{
+  MFRC522_STATUS result;
+
+  // Préparation des valeurs pour le registre PCD_REG_BitFramingReg
+  uint8_t txLastBits = 0;
+  if (validBits != NULL)
+  {
+    txLastBits = *validBits;
+  }
+
+  MFRC522_PCD_CommunicateStart(command, waitIrq, sendData, sendLen, txLastBits, rxAlign, checkCRC);
+
+  // Wait for the command to complete.
+  // In MFRC522_PCD_Init() we set the TAuto flag in TModeReg. This means the timer automatically starts when the PCD stops transmitting.
+#if defined(MFRC522_IRQ_PIN)
+  // Attente de la broche IRQ, sans transaction SPI. Arrêt d'urgence après 35.7ms
+  if (!MFRC522_PCD_WaitIrq(3570))
+  {
+    MFRC522_PCD_WriteRegister(PCD_REG_ComIEnReg, MFRC522_IRQ_INVERT);
+    return MFRC522_STATUS_TIMEOUT;
+  }
+  result = MFRC522_PCD_CommunicateCheck(waitIrq);
+#else
+  // Each iteration of the do-while-loop takes 17.86us.
+  uint16_t i = 2000;
+  while ((result = MFRC522_PCD_CommunicateCheck(waitIrq)) == MFRC522_STATUS_BUSY)
+  {
+    // The emergency break. If all other condions fail we will eventually terminate on this one after 35.7ms.
+    // Communication with the MFRC522 might be down.
+    if (--i == 0)
     {
-      return MFRC522_STATUS_CRC_WRONG;
+      return MFRC522_STATUS_TIMEOUT;
     }
   }
+#endif
+  if (result != MFRC522_STATUS_OK)
+  {
+    return result;
+  }
 
-  return MFRC522_STATUS_OK;
+  return MFRC522_PCD_CommunicateFinish(backData, backLen, validBits, rxAlign, checkCRC);
 }
 
 MFRC522_STATUS MFRC522_PCD_TransceiveData(uint8_t * sendData, uint8_t sendLen, uint8_t * backData,
@@ -781,6 +1155,119 @@ MFRC522_STATUS MFRC522_PICC_WakeupA(MFRC522_PICC_UID * uid)
   return MFRC522_PICC_REQA_or_WUPA(PICC_CMD_WUPA, uid);
 }
 
+/**
+ * @brief     Vérifie que le PICC dispose d'une bit frame anticollision
+ * @details   Cf. 6.4.1 ISO/IEC 14443-3
+ *
+ * @param     [in]      uid         PICC ayant répondu à une commande Request ou Wakeup
+ *
+ * @return    MFRC522_STATUS_OK si le test est OK.
+ *            MFRC522_STATUS_PROPRIETARY_ANTICOLLISION sinon.
+ */
+static MFRC522_STATUS MFRC522_PICC_CheckAnticollision(MFRC522_PICC_UID * uid)
+{
+  uint8_t bit_frame_anticollision = uid->atqa & 0x001F;
+  if (   bit_frame_anticollision != 0x01
+      && bit_frame_anticollision != 0x02
+      && bit_frame_anticollision != 0x04
+      && bit_frame_anticollision != 0x08
+      && bit_frame_anticollision != 0x10
+     )
+  {
+    return MFRC522_STATUS_PROPRIETARY_ANTICOLLISION;
+  }
+
+  return MFRC522_STATUS_OK;
+}
+
+/**
+ * @brief     Construit la trame SELECT du cascade level 1 à partir de la réponse à l'anticollision
+ * @details   La réponse (4 octets de l'UID + BCC) est contrôlée puis recopiée dans @c uid et dans
+ *            @c buffer, complétée de SEL et NVB. Le CRC_A reste à ajouter.
+ *
+ * @param     [out]     buffer      Trame SELECT de 7 octets (peut contenir la réponse en &buffer[2])
+ * @param     [in]      response    Réponse du PICC à l'anticollision
+ * @param     [in]      length      Nombre d'octets de la réponse
+ * @param     [in]      validBits   Nombre de bits valides du dernier octet de la réponse
+ * @param     [out]     uid         Alimenté avec les 4 octets de l'UID
+ *
+ * @return    MFRC522_STATUS_OK si le test est OK.
+ *            MFRC522_STATUS_* en cas d'erreur.
+ */
+static MFRC522_STATUS MFRC522_PICC_SelectFrame(uint8_t * buffer, uint8_t * response, uint8_t length, uint8_t validBits,
+  MFRC522_PICC_UID * uid)
+{
+  // Vérification du retour => 4 octets de l'UID + 1 octet BCC
+  if (   length != 5
+      || validBits != 0)
+  {
+    return MFRC522_STATUS_ERROR;
+  }
+  else
+  {
+    uint8_t bcc = response[0] ^ response[1] ^ response[2] ^ response[3];
+    if (bcc != response[4])
+    {
+      return MFRC522_STATUS_BCC_ERROR;
+    }
+  }
+
+  uid->uid[0] = response[0];
+  uid->uid[1] = response[1];
+  uid->uid[2] = response[2];
+  uid->uid[3] = response[3];
+  uid->uidsize = 4;
+
+  // Sélection de la carte
+  // octets 3 à 6 : 4 octets de l'UID à sélectionner
+  // octet 7 : BCC - Block Check Character
+  for (uint8_t i = 0; i < 5; i++)
+  {
+    buffer[2 + i] = response[i];
+  }
+  // octet 1 : Cascade level 1
+  buffer[0] = PICC_CMD_SEL_CL1;
+  // octet 2 : High nibble => 7 octets plein, Low nibble => Pas d'extra bits
+  buffer[1] = 0x70;
+
+  return MFRC522_STATUS_OK;
+}
+
+/**
+ * @brief     Contrôle la réponse SAK (Select Acknowledge) du PICC
+ *
+ * @param     [in]      response    Réponse du PICC à la trame SELECT
+ * @param     [in]      length      Nombre d'octets de la réponse
+ * @param     [in]      validBits   Nombre de bits valides du dernier octet de la réponse
+ * @param     [out]     uid         Alimenté avec le SAK
+ *
+ * @return    MFRC522_STATUS_OK si le test est OK.
+ *            MFRC522_STATUS_* en cas d'erreur.
+ */
+static MFRC522_STATUS MFRC522_PICC_SelectAcknowledge(uint8_t * response, uint8_t length, uint8_t validBits,
+  MFRC522_PICC_UID * uid)
+{
+  // A ce stade nous devons avoir une réponse SAK (Select Acknowledge) => 1 octet + CRC_A
+  if (   length != 1 + MFRC522_CRC_SIZE
+      || validBits != 0)
+  {
+    return MFRC522_STATUS_ERROR;
+  }
+
+  if (response[0] & 0x04)
+  {
+    //USART_SendString("Need more...\n");
+    /**
+     * @todo    Faire les autres cascade levels
+     */
+    return MFRC522_STATUS_INTERNAL_ERROR;
+  }
+
+  uid->sak = response[0];
+
+  return MFRC522_STATUS_OK;
+}
+
 MFRC522_STATUS MFRC522_PICC_Select(MFRC522_PICC_UID * uid)
 {
   // Pour le debug
@@ -815,15 +1302,10 @@ MFRC522_STATUS MFRC522_PICC_Select(MFRC522_PICC_UID * uid)
   uint8_t responseLength;
 
   // On vérifie que le PICC ou le TAG dispose bien d'une bit frame anticollision (Cf. 6.4.1 ISO/IEC 14443-3)
-  uint8_t bit_frame_anticollision = uid->atqa & 0x001F;
-  if (   bit_frame_anticollision != 0x01
-      && bit_frame_anticollision != 0x02
-      && bit_frame_anticollision != 0x04
-      && bit_frame_anticollision != 0x08
-      && bit_frame_anticollision != 0x10
-     )
+  result = MFRC522_PICC_CheckAnticollision(uid);
+  if (result != MFRC522_STATUS_OK)
   {
-    return MFRC522_STATUS_PROPRIETARY_ANTICOLLISION;
+    return result;
   }
 
 
@@ -872,77 +1354,30 @@ MFRC522_STATUS MFRC522_PICC_Select(MFRC522_PICC_UID * uid)
   USART_SendString("\n");
   */
 
-  // Vérification du retour => 4 octets de l'UID + 1 octet BCC
-  if (   responseLength != 5
-      || txLastBits != 0)
-  {
-    return MFRC522_STATUS_ERROR;
-  }
-  else
+  // Construction de la trame SELECT
+  result = MFRC522_PICC_SelectFrame(buffer, responseBuffer, responseLength, txLastBits, uid);
+  if (result != MFRC522_STATUS_OK)
   {
-    uint8_t bcc = responseBuffer[0] ^ responseBuffer[1] ^ responseBuffer[2] ^ responseBuffer[3];
-    if (bcc != responseBuffer[4])
-    {
-      return MFRC522_STATUS_BCC_ERROR;
-    }
+    return result;
   }
-
-  uid->uid[0] = responseBuffer[0];
-  uid->uid[1] = responseBuffer[1];
-  uid->uid[2] = responseBuffer[2];
-  uid->uid[3] = responseBuffer[3];
-  uid->uidsize = 4;
-
-  // Sélection de la carte
-  // octet 1 : Cascade level 1
-  buffer[0] = PICC_CMD_SEL_CL1;
-  // octet 2 : High nibble => 7 octets plein, Low nibble => Pas d'extra bits
-  buffer[1] = 0x70;
-  // octets 3 à 6 : 4 octets de l'UID à sélectionner
-  buffer[2] = responseBuffer[0];
-  buffer[3] = responseBuffer[1];
-  buffer[4] = responseBuffer[2];
-  buffer[5] = responseBuffer[3];
-  // BCC - Block Check Character
-  buffer[6] = responseBuffer[4];
   // CRC_A
-  uint16_t crc = 0x0000;
-  result = MFRC522_PCD_CalculateCRC(buffer, 7, &crc);
+  result = MFRC522_PCD_AppendCRC(buffer, 7);
   if (result != MFRC522_STATUS_OK)
   {
     return result;
   }
-  buffer[7] = (crc & 0xFF00) >> 8;
-  buffer[8] = crc & 0x00FF;
   // 0 => Tous les octets sont plein
   txLastBits = 0x00;
   rxAlign = 0x00;
   responseLength = 10;
-  result = MFRC522_PCD_TransceiveData(buffer, 9, responseBuffer, &responseLength, &txLastBits, rxAlign, 1);
+  result = MFRC522_PCD_TransceiveData(buffer, 7 + MFRC522_CRC_SIZE, responseBuffer, &responseLength, &txLastBits, rxAlign,
+    MFRC522_CRC_TX | MFRC522_CRC_RX);
   if (result != MFRC522_STATUS_OK)
   {
     return result;
   }
 
-  // A ce stade nous devons avoir une réponse SAK (Select Acknowledge) => 1 octet + CRC_A
-  if (   responseLength != 3
-      || txLastBits != 0)
-  {
-    return MFRC522_STATUS_ERROR;
-  }
-
-  if (responseBuffer[0] & 0x04)
-  {
-    //USART_SendString("Need more...\n");
-    /**
-     * @todo    Faire les autres cascade levels
-     */
-    return MFRC522_STATUS_INTERNAL_ERROR;
-  }
-
-  uid->sak = responseBuffer[0];
-
-  return MFRC522_STATUS_OK;
+  return MFRC522_PICC_SelectAcknowledge(responseBuffer, responseLength, txLastBits, uid);
 
 
 
@@ -1227,28 +1662,25 @@ MFRC522_STATUS MFRC522_PICC_Select(MFRC522_PICC_UID * uid)
 MFRC522_STATUS MFRC522_PICC_HaltA()
 {
   MFRC522_STATUS result;
-  uint8_t buffer[4];
+  uint8_t buffer[2 + MFRC522_CRC_SIZE];
 
   // Construction du buffer pour la commande
   buffer[0] = PICC_CMD_HLTA;
   buffer[1] = 0x00;
 
   // Calcule du CRC_A
-  uint16_t crc = 0x0000;
-  result = MFRC522_PCD_CalculateCRC(buffer, 2, &crc);
+  result = MFRC522_PCD_AppendCRC(buffer, 2);
   if (result != MFRC522_STATUS_OK)
   {
     return result;
   }
-  buffer[2] = (crc & 0xFF00) >> 8;
-  buffer[3] = crc & 0x00FF;
 
   // Envoi de la commande
   // Le standard dit :
   //    Si le PICC répond sans modulation durant une période de 1ms après la din de la frame contenant la commande
   //    HALT, sa réponse devrait être interprétée comme "non acquité".
   // L'interprétation faite ici : Seul un timeout est un succès
-  result = MFRC522_PCD_TransceiveData(buffer, 4, NULL, NULL, NULL, 0, 0);
+  result = MFRC522_PCD_TransceiveData(buffer, sizeof(buffer), NULL, NULL, NULL, 0, MFRC522_CRC_TX);
   if (result == MFRC522_STATUS_TIMEOUT)
   {
     return MFRC522_STATUS_OK;
@@ -1290,21 +1722,20 @@ MFRC522_STATUS MFRC522_MIFARE_Transceive(uint8_t * sendData, uint8_t sendLen, ui
     buffer[i] = sendData[i];
   }
 
-  uint16_t crc = 0x0000;
-  result = MFRC522_PCD_CalculateCRC(buffer, sendLen, &crc);
+  result = MFRC522_PCD_AppendCRC(buffer, sendLen);
   if (result != MFRC522_STATUS_OK)
   {
     return result;
   }
-  buffer[sendLen++]     = (crc & 0xFF00) >> 8;
-  buffer[sendLen++] = crc & 0x00FF;
+  sendLen += MFRC522_CRC_SIZE;
 
   // Envoi des données et récupération du résultat dans buffer
   // RxIRq and IdleIRq
   uint8_t waitIRq = 0x30;
   uint8_t bufferSize = 18;
   uint8_t validBits = 0;
-  result = MFRC522_PCD_CommunicateWithPICC(PCD_CMD_Transceive, waitIRq, buffer, sendLen, buffer, &bufferSize, &validBits, 0, 0);
+  result = MFRC522_PCD_CommunicateWithPICC(PCD_CMD_Transceive, waitIRq, buffer, sendLen, buffer, &bufferSize, &validBits, 0,
+    MFRC522_CRC_TX);
   if (acceptTimeout && result == MFRC522_STATUS_TIMEOUT)
   {
     return MFRC522_STATUS_OK;
@@ -1362,13 +1793,21 @@ MFRC522_STATUS MFRC522_MIFARE_Transceive(uint8_t * sendData, uint8_t sendLen, ui
 	return MFRC522_STATUS_OK;
 }
 
-MFRC522_STATUS MFRC522_MIFARE_Authenticate(MFRC522_AUTH_KEY keytype, uint8_t blockAddr, MFRC522_MIFARE_KEY * key, MFRC522_PICC_UID * uid)
+/**
+ * @brief     Construit la trame de la commande MFAuthent
+ *
+ * @param     [out]     sendData       Trame de 2 + MFRC522_AUTH_KEY_SIZE + 4 octets
+ * @param     [in]      keytype        Type de clef à utiliser pour l'authentification
+ * @param     [in]      blockAddr      Adresse du bloc sur lequel s'authentifier
+ * @param     [in]      key            Clef à utiliser pour l'authentification
+ * @param     [in]      uid            Carte sur laquelle effectuer l'authentification
+ *
+ * @return    MFRC522_STATUS_OK si le test est OK.
+ *            MFRC522_STATUS_INTERNAL_ERROR si le type de clef est inconnu.
+ */
+static MFRC522_STATUS MFRC522_MIFARE_AuthenticateFrame(uint8_t * sendData, MFRC522_AUTH_KEY keytype, uint8_t blockAddr,
+  MFRC522_MIFARE_KEY * key, MFRC522_PICC_UID * uid)
 {
-  // IdleIRq
-  uint8_t waitIRq = 0x10;
-
-  uint8_t sendData[2 + MFRC522_AUTH_KEY_SIZE + 4];
-  uint8_t sendLen = 2 + MFRC522_AUTH_KEY_SIZE + 4;
   switch (keytype)
   {
     case MFRC522_AUTH_KEY_A:
@@ -1390,6 +1829,24 @@ MFRC522_STATUS MFRC522_MIFARE_Authenticate(MFRC522_AUTH_KEY keytype, uint8_t blo
     sendData[2 + MFRC522_AUTH_KEY_SIZE + i] = uid->uid[i];
   }
 
+  return MFRC522_STATUS_OK;
+}
+
+MFRC522_STATUS MFRC522_MIFARE_Authenticate(MFRC522_AUTH_KEY keytype, uint8_t blockAddr, MFRC522_MIFARE_KEY * key, MFRC522_PICC_UID * uid)
+{
+  MFRC522_STATUS result;
+
+  // IdleIRq
+  uint8_t waitIRq = 0x10;
+
+  uint8_t sendData[2 + MFRC522_AUTH_KEY_SIZE + 4];
+  uint8_t sendLen = 2 + MFRC522_AUTH_KEY_SIZE + 4;
+  result = MFRC522_MIFARE_AuthenticateFrame(sendData, keytype, blockAddr, key, uid);
+  if (result != MFRC522_STATUS_OK)
+  {
+    return result;
+  }
+
   return MFRC522_PCD_CommunicateWithPICC(PCD_CMD_MFAuthent, waitIRq, sendData, sendLen, NULL, NULL, NULL, 0, 0);
 }
 
@@ -1407,16 +1864,13 @@ MFRC522_STATUS MFRC522_MIFARE_Read(uint8_t blockAddr, uint8_t * buffer, uint8_t
   buffer[0] = PICC_CMD_MF_READ;
   buffer[1] = blockAddr;
   // Calcule du CRC_A
-  uint16_t crc = 0x0000;
-  result = MFRC522_PCD_CalculateCRC(buffer, 2, &crc);
+  result = MFRC522_PCD_AppendCRC(buffer, 2);
   if (result != MFRC522_STATUS_OK)
   {
     return result;
   }
-  buffer[2] = (crc & 0xFF00) >> 8;
-  buffer[3] = crc & 0x00FF;
 
-  return MFRC522_PCD_TransceiveData(buffer, 4, buffer, bufferSize, NULL, 0, 1);
+  return MFRC522_PCD_TransceiveData(buffer, 2 + MFRC522_CRC_SIZE, buffer, bufferSize, NULL, 0, MFRC522_CRC_TX | MFRC522_CRC_RX);
 }
 
 MFRC522_STATUS MFRC522_MIFARE_Write(uint8_t blockAddr, uint8_t * buffer, uint8_t bufferSize)
@@ -1593,6 +2047,483 @@ void MFRC522_MIFARE_SetAccessBits(uint8_t * accessBitBuffer, uint8_t g0, uint8_t
 	accessBitBuffer[2] =          c3 << 4 | c2;
 }
 
+#if defined(MFRC522_ASYNC)
+
+/////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous functions
+/////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief     Opérations asynchrones
+ */
+typedef enum
+{
+  MFRC522_ASYNC_NONE = 0,         /**< Aucune opération en cours */
+  MFRC522_ASYNC_REQA_or_WUPA,     /**< MFRC522_PICC_RequestAStart() ou MFRC522_PICC_WakeupAStart() */
+  MFRC522_ASYNC_SELECT,           /**< MFRC522_PICC_SelectStart() */
+  MFRC522_ASYNC_AUTHENTICATE,     /**< MFRC522_MIFARE_AuthenticateStart() */
+  MFRC522_ASYNC_READ              /**< MFRC522_MIFARE_ReadStart() */
+} MFRC522_ASYNC_OPERATION;
+
+/**
+ * @brief     Phases d'un échange asynchrone
+ * @details   Sans MFRC522_HW_CRC, le CRC_A est calculé par le coprocesseur du MFRC522 avant
+ *            l'envoi de la trame et après la réception de la réponse, chaque calcul étant une
+ *            phase de l'échange : aucune attente n'est faite dans MFRC522_PCD_AsyncPoll().
+ */
+typedef enum
+{
+  MFRC522_ASYNC_EXCHANGE = 0,     /**< Commande en cours d'exécution */
+  MFRC522_ASYNC_TX_CRC,           /**< Calcul du CRC_A de la trame à envoyer */
+  MFRC522_ASYNC_RX_CRC            /**< Calcul du CRC_A de la réponse reçue */
+} MFRC522_ASYNC_PHASE;
+
+/**
+ * @brief     Contexte de l'opération asynchrone en cours
+ */
+static struct
+{
+  volatile MFRC522_ASYNC_OPERATION  operation;  /**< Opération en cours */
+  volatile uint8_t                  polling;    /**< MFRC522_PCD_AsyncPoll() ou une fonction *Start() en cours d'exécution */
+  volatile MFRC522_STATUS           status;     /**< Résultat de la dernière opération */
+  uint8_t                           step;       /**< Etape de l'opération */
+  MFRC522_ASYNC_PHASE               phase;      /**< Phase de l'échange de l'étape */
+#if !defined(MFRC522_IRQ_PIN)
+  uint16_t                          polls;      /**< Nombre d'appels restant avant l'arrêt d'urgence de la phase */
+#endif
+  PCD_CMD                           command;    /**< Commande de l'échange */
+  uint8_t                           waitIrq;    /**< Bits de ComIrqReg signalant la fin de la commande */
+  uint8_t *                         sendData;   /**< Trame à envoyer */
+  uint8_t                           sendLen;    /**< Taille de la trame à envoyer */
+  uint8_t                           txLastBits; /**< Nombre de bits valides du dernier octet envoyé */
+  uint8_t                           checkCRC;   /**< Validation du CRC_A de la réponse */
+  uint8_t                           validBits;  /**< Nombre de bits valides du dernier octet reçu */
+  uint8_t                           length;     /**< Taille de la réponse stockée dans buffer */
+  uint8_t *                         backData;   /**< Buffer de la réponse */
+  uint8_t *                         backLen;    /**< Taille du buffer de la réponse */
+  MFRC522_PICC_UID *                uid;        /**< PICC de l'opération */
+  uint8_t                           buffer[2 + MFRC522_AUTH_KEY_SIZE + 4];  /**< Trames envoyées et réponses reçues */
+} MFRC522_async;
+
+/**
+ * @brief     Réserve le contexte pour une nouvelle opération asynchrone
+ *
+ * @param     [in]      operation   Opération à démarrer
+ *
+ * @return    MFRC522_STATUS_OK si le contexte est réservé.
+ *            MFRC522_STATUS_BUSY si une opération asynchrone est déjà en cours.
+ */
+static MFRC522_STATUS MFRC522_PCD_AsyncBegin(MFRC522_ASYNC_OPERATION operation)
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    if (MFRC522_async.operation != MFRC522_ASYNC_NONE)
+    {
+      return MFRC522_STATUS_BUSY;
+    }
+    MFRC522_async.operation = operation;
+    MFRC522_async.polling = 1;
+    MFRC522_async.status = MFRC522_STATUS_BUSY;
+  }
+  MFRC522_async.step = 0;
+
+  return MFRC522_STATUS_OK;
+}
+
+/**
+ * @brief     Libère le contexte de l'opération asynchrone
+ * @details   L'opération est terminée si @c status n'est pas MFRC522_STATUS_BUSY.
+ *
+ * @param     [in]      status      Résultat de l'étape en cours
+ *
+ * @return    @c status
+ */
+static MFRC522_STATUS MFRC522_PCD_AsyncRelease(MFRC522_STATUS status)
+{
+  if (status != MFRC522_STATUS_BUSY)
+  {
+    MFRC522_async.operation = MFRC522_ASYNC_NONE;
+  }
+  MFRC522_async.status = status;
+  MFRC522_async.polling = 0;
+
+  return status;
+}
+
+/**
+ * @brief     Démarre une phase de l'échange asynchrone
+ * @details   Sans MFRC522_IRQ_PIN, le nombre d'appels de MFRC522_PCD_AsyncPoll() accordés à la
+ *            phase est réinitialisé : 2000 pour une commande (35.7ms en appels continus) et 5000
+ *            pour un calcul de CRC_A (89ms), comme les fonctions bloquantes.
+ *
+ * @param     [in]      phase       Phase démarrée
+ */
+static void MFRC522_PCD_AsyncPhase(MFRC522_ASYNC_PHASE phase)
+{
+  MFRC522_async.phase = phase;
+#if !defined(MFRC522_IRQ_PIN)
+  MFRC522_async.polls = (phase == MFRC522_ASYNC_EXCHANGE) ? 2000 : 5000;
+#endif
+}
+
+/**
+ * @brief     Lance la commande de l'échange asynchrone mémorisé
+ *
+ * @return    MFRC522_STATUS_BUSY
+ */
+static MFRC522_STATUS MFRC522_PCD_AsyncCommunicate(void)
+{
+  MFRC522_PCD_AsyncPhase(MFRC522_ASYNC_EXCHANGE);
+  MFRC522_PCD_CommunicateStart(MFRC522_async.command, MFRC522_async.waitIrq, MFRC522_async.sendData,
+    MFRC522_async.sendLen, MFRC522_async.txLastBits, 0, MFRC522_async.checkCRC);
+
+  return MFRC522_STATUS_BUSY;
+}
+
+/**
+ * @brief     Lance l'échange d'une étape de l'opération asynchrone
+ * @details   Les paramètres de réception sont mémorisés pour MFRC522_PCD_CommunicateFinish().
+ *            Sans MFRC522_HW_CRC, le calcul du CRC_A de la trame est lancé d'abord si
+ *            MFRC522_CRC_TX est demandé : @c sendData doit alors pouvoir recevoir 2 octets de plus.
+ *
+ * @param     [in]      command     Commande à exécuter
+ * @param     [in]      waitIrq     Mask de bit du registre PCD_REG_ComIrqReg signalant la bonne terminaison de la commande
+ * @param     [in]      sendData    Pointeur des données à transférer dans la FIFO
+ * @param     [in]      sendLen     Nombre d'octets à transférer dans la FIFO (sans le CRC_A)
+ * @param     [in]      txLastBits  Nombre de bits valides du dernier octet envoyé (0 : octet complet)
+ * @param     [out]     backData    NULL ou pointeur vers le buffer devant récupérer les données après transfert
+ * @param     [in]      backLen     Nombre max d'octets pouvant être écrit dans le buffer backData
+ * @param     [in]      checkCRC    Combinaison de MFRC522_CRC_TX et MFRC522_CRC_RX
+ *
+ * @return    MFRC522_STATUS_BUSY
+ */
+static MFRC522_STATUS MFRC522_PCD_AsyncExchange(PCD_CMD command, uint8_t waitIrq, uint8_t * sendData, uint8_t sendLen,
+  uint8_t txLastBits, uint8_t * backData, uint8_t * backLen, uint8_t checkCRC)
+{
+  MFRC522_async.command = command;
+  MFRC522_async.waitIrq = waitIrq;
+  MFRC522_async.sendData = sendData;
+  MFRC522_async.sendLen = sendLen;
+  MFRC522_async.txLastBits = txLastBits;
+  MFRC522_async.backData = backData;
+  MFRC522_async.backLen = backLen;
+  MFRC522_async.checkCRC = checkCRC;
+  MFRC522_async.validBits = 0;
+
+#if !defined(MFRC522_HW_CRC)
+  if (checkCRC & MFRC522_CRC_TX)
+  {
+    MFRC522_PCD_AsyncPhase(MFRC522_ASYNC_TX_CRC);
+    MFRC522_PCD_CalculateCRCStart(sendData, sendLen);
+    return MFRC522_STATUS_BUSY;
+  }
+#endif
+
+  return MFRC522_PCD_AsyncCommunicate();
+}
+
+/**
+ * @brief     Traite le résultat d'une étape de l'opération asynchrone
+ * @details   Contrôle la réponse du PICC et lance l'étape suivante s'il y en a une.
+ *
+ * @param     [in]      result      Résultat de l'échange terminé
+ *
+ * @return    MFRC522_STATUS_BUSY si une nouvelle étape est lancée.
+ *            Le résultat de l'opération sinon.
+ */
+static MFRC522_STATUS MFRC522_PCD_AsyncNext(MFRC522_STATUS result)
+{
+  if (result != MFRC522_STATUS_OK)
+  {
+    return result;
+  }
+
+  switch (MFRC522_async.operation)
+  {
+    case MFRC522_ASYNC_REQA_or_WUPA:
+      if (MFRC522_async.length != 2 || MFRC522_async.validBits != 0)
+      {
+        // ATQA must be exactly 16 bits.
+        return MFRC522_STATUS_ERROR;
+      }
+      return MFRC522_STATUS_OK;
+
+    case MFRC522_ASYNC_SELECT:
+      if (MFRC522_async.step == 0)
+      {
+        // Réponse à l'anticollision reçue en &buffer[2] : envoi de la trame SELECT
+        result = MFRC522_PICC_SelectFrame(MFRC522_async.buffer, &MFRC522_async.buffer[2], MFRC522_async.length,
+          MFRC522_async.validBits, MFRC522_async.uid);
+        if (result != MFRC522_STATUS_OK)
+        {
+          return result;
+        }
+        MFRC522_async.step = 1;
+        MFRC522_async.length = sizeof(MFRC522_async.buffer);
+        return MFRC522_PCD_AsyncExchange(PCD_CMD_Transceive, 0x30, MFRC522_async.buffer, 7, 0,
+          MFRC522_async.buffer, &MFRC522_async.length, MFRC522_CRC_TX | MFRC522_CRC_RX);
+      }
+      return MFRC522_PICC_SelectAcknowledge(MFRC522_async.buffer, MFRC522_async.length, MFRC522_async.validBits,
+        MFRC522_async.uid);
+
+    case MFRC522_ASYNC_AUTHENTICATE:
+    case MFRC522_ASYNC_READ:
+      return MFRC522_STATUS_OK;
+
+    default:
+      return MFRC522_STATUS_INTERNAL_ERROR;
+  }
+}
+
+/**
+ * @brief     Teste la fin de la phase en cours de l'échange asynchrone
+ *
+ * @return    MFRC522_STATUS_BUSY tant que la phase n'est pas terminée.
+ *            MFRC522_STATUS_TIMEOUT si le timer du MFRC522 a expiré ou si la phase dépasse sa limite d'appels.
+ *            MFRC522_STATUS_OK si la phase est terminée.
+ */
+static MFRC522_STATUS MFRC522_PCD_AsyncCheck(void)
+{
+  MFRC522_STATUS result;
+
+#if !defined(MFRC522_HW_CRC)
+  if (MFRC522_async.phase != MFRC522_ASYNC_EXCHANGE)
+  {
+    result = MFRC522_PCD_CalculateCRCCheck();
+  }
+  else
+#endif
+  {
+    result = MFRC522_PCD_CommunicateCheck(MFRC522_async.waitIrq);
+  }
+
+#if !defined(MFRC522_IRQ_PIN)
+  // The emergency break. Communication with the MFRC522 might be down.
+  if (result == MFRC522_STATUS_BUSY && --MFRC522_async.polls == 0)
+  {
+    MFRC522_PCD_WriteRegister(PCD_REG_CommandReg, PCD_CMD_Idle);
+    return MFRC522_STATUS_TIMEOUT;
+  }
+#endif
+
+  return result;
+}
+
+/**
+ * @brief     Exploite la fin de la phase en cours de l'échange asynchrone
+ * @details   Lance la phase suivante de l'échange, ou traite son résultat par MFRC522_PCD_AsyncNext().
+ *
+ * @return    MFRC522_STATUS_BUSY si une nouvelle phase ou étape est lancée.
+ *            Le résultat de l'opération sinon.
+ */
+static MFRC522_STATUS MFRC522_PCD_AsyncDone(void)
+{
+  MFRC522_STATUS result;
+
+#if defined(MFRC522_HW_CRC)
+  result = MFRC522_PCD_CommunicateFinish(MFRC522_async.backData, MFRC522_async.backLen, &MFRC522_async.validBits, 0,
+    MFRC522_async.checkCRC);
+#else
+  uint16_t crc;
+
+  switch (MFRC522_async.phase)
+  {
+    case MFRC522_ASYNC_TX_CRC:
+      // Ajout du CRC_A à la trame, puis lancement de la commande
+      MFRC522_PCD_CalculateCRCFinish(&crc);
+      MFRC522_async.sendData[MFRC522_async.sendLen++] = (crc & 0xFF00) >> 8;
+      MFRC522_async.sendData[MFRC522_async.sendLen++] = crc & 0xFF;
+      return MFRC522_PCD_AsyncCommunicate();
+
+    case MFRC522_ASYNC_RX_CRC:
+      MFRC522_PCD_CalculateCRCFinish(&crc);
+      return MFRC522_PCD_AsyncNext(MFRC522_PCD_CompareCRC(MFRC522_async.backData, *MFRC522_async.backLen, crc));
+
+    default:
+      break;
+  }
+
+  // Le CRC_A de la réponse est validé par la phase MFRC522_ASYNC_RX_CRC
+  result = MFRC522_PCD_CommunicateFinish(MFRC522_async.backData, MFRC522_async.backLen, &MFRC522_async.validBits, 0,
+    MFRC522_async.checkCRC & ~MFRC522_CRC_RX);
+  if (result == MFRC522_STATUS_OK && (MFRC522_async.checkCRC & MFRC522_CRC_RX))
+  {
+    result = MFRC522_PCD_CheckCRCFrame(*MFRC522_async.backLen, MFRC522_async.validBits);
+    if (result == MFRC522_STATUS_OK)
+    {
+      MFRC522_PCD_AsyncPhase(MFRC522_ASYNC_RX_CRC);
+      MFRC522_PCD_CalculateCRCStart(MFRC522_async.backData, *MFRC522_async.backLen - 2);
+      return MFRC522_STATUS_BUSY;
+    }
+  }
+#endif
+
+  return MFRC522_PCD_AsyncNext(result);
+}
+
+MFRC522_STATUS MFRC522_PCD_AsyncPoll(void)
+{
+  MFRC522_STATUS result;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    if (MFRC522_async.polling)
+    {
+      // Appel imbriqué (interruption pendant un appel de la boucle principale)
+      return MFRC522_STATUS_BUSY;
+    }
+    if (MFRC522_async.operation == MFRC522_ASYNC_NONE)
+    {
+      return MFRC522_async.status;
+    }
+    MFRC522_async.polling = 1;
+  }
+
+  result = MFRC522_PCD_AsyncCheck();
+  if (result == MFRC522_STATUS_OK)
+  {
+    result = MFRC522_PCD_AsyncDone();
+  }
+  else if (result != MFRC522_STATUS_BUSY)
+  {
+    result = MFRC522_PCD_AsyncNext(result);
+  }
+
+  return MFRC522_PCD_AsyncRelease(result);
+}
+
+void MFRC522_PCD_AsyncAbort(void)
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    if (MFRC522_async.operation != MFRC522_ASYNC_NONE)
+    {
+      // Stop any active command.
+      MFRC522_PCD_WriteRegister(PCD_REG_CommandReg, PCD_CMD_Idle);
+#if defined(MFRC522_IRQ_PIN)
+      MFRC522_PCD_WriteRegister(PCD_REG_ComIEnReg, MFRC522_IRQ_INVERT);
+      MFRC522_PCD_WriteRegister(PCD_REG_DivIEnReg, MFRC522_IRQ_PUSHPULL);
+#endif
+      MFRC522_async.operation = MFRC522_ASYNC_NONE;
+      MFRC522_async.status = MFRC522_STATUS_TIMEOUT;
+    }
+  }
+}
+
+/**
+ * @brief     Lance une commande Wakeup ou Request de type A sans attendre la réponse
+ *
+ * @param     [in]      command     Command PICC à envoyer
+ * @param     [in,out]  uid         Pointeur sur une structure de type MFRC522_PICC_UID.@n
+ *                                  La zone ATQA est alimentée à la fin de l'opération
+ *
+ * @return    MFRC522_STATUS_OK si l'opération est lancée.
+ *            MFRC522_STATUS_BUSY si une opération asynchrone est déjà en cours.
+ */
+static MFRC522_STATUS MFRC522_PICC_REQA_or_WUPAStart(PICC_CMD command, MFRC522_PICC_UID * uid)
+{
+  if (MFRC522_PCD_AsyncBegin(MFRC522_ASYNC_REQA_or_WUPA) != MFRC522_STATUS_OK)
+  {
+    return MFRC522_STATUS_BUSY;
+  }
+
+  // ValuesAfterColl=1 => Suppression de tous les bits reçu après une collision
+  MFRC522_PCD_ClearRegisterBitMask(PCD_REG_CollReg, 0x80);
+  // Short frame format : 7 bits
+  MFRC522_async.buffer[0] = command;
+  MFRC522_async.length = sizeof(uid->atqa);
+  MFRC522_PCD_AsyncRelease(MFRC522_PCD_AsyncExchange(PCD_CMD_Transceive, 0x30, MFRC522_async.buffer, 1, 7,
+    (uint8_t *)&uid->atqa, &MFRC522_async.length, 0));
+
+  return MFRC522_STATUS_OK;
+}
+
+MFRC522_STATUS MFRC522_PICC_RequestAStart(MFRC522_PICC_UID * uid)
+{
+  return MFRC522_PICC_REQA_or_WUPAStart(PICC_CMD_REQA, uid);
+}
+
+MFRC522_STATUS MFRC522_PICC_WakeupAStart(MFRC522_PICC_UID * uid)
+{
+  return MFRC522_PICC_REQA_or_WUPAStart(PICC_CMD_WUPA, uid);
+}
+
+MFRC522_STATUS MFRC522_PICC_SelectStart(MFRC522_PICC_UID * uid)
+{
+  MFRC522_STATUS result;
+
+  if (MFRC522_PCD_AsyncBegin(MFRC522_ASYNC_SELECT) != MFRC522_STATUS_OK)
+  {
+    return MFRC522_STATUS_BUSY;
+  }
+
+  result = MFRC522_PICC_CheckAnticollision(uid);
+  if (result != MFRC522_STATUS_OK)
+  {
+    return MFRC522_PCD_AsyncRelease(result);
+  }
+
+  // ValuesAfterColl=1 => Suppression de tous les bits reçu après une collision
+  MFRC522_PCD_ClearRegisterBitMask(PCD_REG_CollReg, 0x80);
+
+  // Anticollision du cascade level 1, la réponse est reçue en &buffer[2] pour construire la trame SELECT
+  MFRC522_async.uid = uid;
+  MFRC522_async.buffer[0] = PICC_CMD_SEL_CL1;
+  MFRC522_async.buffer[1] = 0x20;
+  MFRC522_async.length = sizeof(MFRC522_async.buffer) - 2;
+  MFRC522_PCD_AsyncRelease(MFRC522_PCD_AsyncExchange(PCD_CMD_Transceive, 0x30, MFRC522_async.buffer, 2, 0,
+    &MFRC522_async.buffer[2], &MFRC522_async.length, 0));
+
+  return MFRC522_STATUS_OK;
+}
+
+MFRC522_STATUS MFRC522_MIFARE_AuthenticateStart(MFRC522_AUTH_KEY keytype, uint8_t blockAddr, MFRC522_MIFARE_KEY * key, MFRC522_PICC_UID * uid)
+{
+  MFRC522_STATUS result;
+
+  if (MFRC522_PCD_AsyncBegin(MFRC522_ASYNC_AUTHENTICATE) != MFRC522_STATUS_OK)
+  {
+    return MFRC522_STATUS_BUSY;
+  }
+
+  result = MFRC522_MIFARE_AuthenticateFrame(MFRC522_async.buffer, keytype, blockAddr, key, uid);
+  if (result != MFRC522_STATUS_OK)
+  {
+    return MFRC522_PCD_AsyncRelease(result);
+  }
+
+  // IdleIRq
+  MFRC522_PCD_AsyncRelease(MFRC522_PCD_AsyncExchange(PCD_CMD_MFAuthent, 0x10, MFRC522_async.buffer,
+    sizeof(MFRC522_async.buffer), 0, NULL, NULL, 0));
+
+  return MFRC522_STATUS_OK;
+}
+
+MFRC522_STATUS MFRC522_MIFARE_ReadStart(uint8_t blockAddr, uint8_t * buffer, uint8_t * bufferSize)
+{
+  if (MFRC522_PCD_AsyncBegin(MFRC522_ASYNC_READ) != MFRC522_STATUS_OK)
+  {
+    return MFRC522_STATUS_BUSY;
+  }
+
+  buffer[0] = PICC_CMD_MF_READ;
+  buffer[1] = blockAddr;
+  MFRC522_PCD_AsyncRelease(MFRC522_PCD_AsyncExchange(PCD_CMD_Transceive, 0x30, buffer, 2, 0, buffer,
+    bufferSize, MFRC522_CRC_TX | MFRC522_CRC_RX));
+
+  return MFRC522_STATUS_OK;
+}
+
+#  if defined(MFRC522_IRQ_vect)
+// La fin de chaque commande ou calcul de CRC_A du MFRC522 fait progresser l'opération asynchrone en cours
+ISR(MFRC522_IRQ_vect)
+{
+  MFRC522_PCD_AsyncPoll();
+}
+#  endif
+
+#endif
+
 #endif /* _MFRC522_CORE_H_ */
 
 
@@ -17,6 +17,19 @@
  *
  * @note      La définition de SPI_PIN n'est à faire qu'en mode software.
  *
+ * @note      Plusieurs périphériques peuvent partager le bus. Chaque périphérique
+ *            est décrit par une structure SPI_DEVICE (broche chip-select, mode et
+ *            diviseur d'horloge) et la configuration du bus est réappliquée à chaque
+ *            sélection (Cf. SPI_SelectDevice()). L'esclave par défaut (SPI_SS_PIN)
+ *            utilise la configuration SPI_MODE / SPI_CLOCK.
+ *
+ * @note      La définition de SPI_STATS active l'instrumentation du bus : pour chaque
+ *            chip-select sont comptés les octets, les transactions et le temps pendant
+ *            lequel le chip-select est actif (Cf. SPI_GetStats()). Le temps est mesuré
+ *            avec le timer 16 bits SPI_STATS_TIMER (TCNT1 par défaut) qui doit être
+ *            démarré en mode libre par l'application. Sans SPI_STATS, l'instrumentation
+ *            n'a aucun coût.
+ *
  * Exemple de code en mode hardware :
  * @code
  * #include <avr/io.h>
@@ -130,6 +143,154 @@
 
 #include <stdint.h>
 
+/**
+ * @brief     Diviseurs d'horloge du SPI hardware
+ * @details   Enumération des fréquences d'horloge possibles du bus SPI en mode hardware.
+ *            Les bits 1 et 0 correspondent aux bits SPR1 et SPR0 du registre SPCR,
+ *            le bit 2 correspond au bit SPI2X du registre SPSR.
+ */
+typedef enum
+{
+  SPI_CLOCK_DIV_2   = 0x04,       /**< fck/2 */
+  SPI_CLOCK_DIV_4   = 0x00,       /**< fck/4 */
+  SPI_CLOCK_DIV_8   = 0x05,       /**< fck/8 */
+  SPI_CLOCK_DIV_16  = 0x01,       /**< fck/16 */
+  SPI_CLOCK_DIV_32  = 0x06,       /**< fck/32 */
+  SPI_CLOCK_DIV_64  = 0x02,       /**< fck/64 */
+  SPI_CLOCK_DIV_128 = 0x03        /**< fck/128 */
+} SPI_CLOCK_DIV;
+
+/**
+ * @brief     Modes SPI
+ * @details   Enumération des modes SPI (polarité et phase de l'horloge).
+ *            Les valeurs correspondent aux bits CPOL et CPHA du registre SPCR.
+ *
+ * @note      Le mode software ne gère que le mode SPI_MODE_0.
+ */
+typedef enum
+{
+  SPI_MODE_0        = 0x00,       /**< CPOL = 0, CPHA = 0 */
+  SPI_MODE_1        = 0x04,       /**< CPOL = 0, CPHA = 1 */
+  SPI_MODE_2        = 0x08,       /**< CPOL = 1, CPHA = 0 */
+  SPI_MODE_3        = 0x0C        /**< CPOL = 1, CPHA = 1 */
+} SPI_MODE_TYPE;
+
+/**
+ * @brief     Mode SPI de l'esclave par défaut (SPI_SS_PIN)
+ */
+#if !defined(SPI_MODE)
+#  define SPI_MODE                SPI_MODE_0
+#endif
+
+/**
+ * @brief     Diviseur d'horloge de l'esclave par défaut (SPI_SS_PIN)
+ */
+#if !defined(SPI_CLOCK)
+#  define SPI_CLOCK               SPI_CLOCK_DIV_16
+#endif
+
+/**
+ * @brief     Périphérique SPI
+ * @details   Structure décrivant un périphérique du bus SPI : sa broche chip-select
+ *            et la configuration du bus à appliquer lors de sa sélection.
+ *
+ * @note      La structure est à initialiser avec la macro SPI_DEVICE_INIT().
+ */
+typedef struct
+{
+  volatile uint8_t * port;        /**< PORT de la broche chip-select */
+  uint8_t            mask;        /**< Masque de la broche chip-select */
+  uint8_t            spcr;        /**< Valeur du registre SPCR (mode et diviseur) */
+  uint8_t            spsr;        /**< Valeur du registre SPSR (double vitesse) */
+} SPI_DEVICE;
+
+/**
+ * @brief       Initialiseur d'une structure SPI_DEVICE
+ *
+ * @param       [in]     cs_port    PORT de la broche chip-select (ex : PORTB)
+ * @param       [in]     cs_pin     Broche chip-select (ex : PINB0)
+ * @param       [in]     mode       Mode SPI du périphérique (SPI_MODE_*)
+ * @param       [in]     clock      Diviseur d'horloge du périphérique (SPI_CLOCK_DIV_*)
+ *
+ * @note        En mode software, le mode et le diviseur d'horloge sont ignorés.
+ *
+ * Exemple :
+ * @code
+ * const SPI_DEVICE radio = SPI_DEVICE_INIT(PORTB, PINB0, SPI_MODE_0, SPI_CLOCK_DIV_4);
+ * @endcode
+ */
+#if defined(SPI_SOFTWARE)
+#  define SPI_DEVICE_INIT(cs_port, cs_pin, mode, clock)                             \
+  { &(cs_port), _BV(cs_pin), 0, 0 }
+#else
+#  define SPI_DEVICE_INIT(cs_port, cs_pin, mode, clock)                             \
+  { &(cs_port), _BV(cs_pin), _BV(SPE) | _BV(MSTR) | (mode) | ((clock) & 0x03),      \
+    ((clock) & 0x04) ? _BV(SPI2X) : 0 }
+#endif
+
+#if defined(SPI_STATS)
+
+/**
+ * @brief     Timer 16 bits libre utilisé pour mesurer l'occupation du bus
+ *
+ * @warning   Chaque activation d'un chip-select est mesurée par une différence de deux valeurs
+ *            du timer : une activation plus longue que 65535 ticks n'est pas détectée et est
+ *            comptée modulo 65536. Le préscaler du timer doit être choisi en fonction des plus
+ *            longues transactions attendues. A 16MHz, sans préscaler, la limite est de 4.1ms ;
+ *            avec un préscaler de 64 (4us par tick) elle est de 262ms, ce qui couvre les échanges
+ *            les plus longs du MFRC522 (timeout de 25ms).
+ */
+#  if !defined(SPI_STATS_TIMER)
+#    define SPI_STATS_TIMER       TCNT1
+#  endif
+
+/**
+ * @brief     Nombre de chip-select instrumentés (esclave par défaut compris)
+ */
+#  if !defined(SPI_STATS_DEVICES)
+#    define SPI_STATS_DEVICES     4
+#  endif
+
+/**
+ * @brief     Statistiques d'utilisation du bus SPI pour un chip-select
+ *
+ * @note      Les durées sont exprimées en ticks de SPI_STATS_TIMER. Elles mesurent le temps
+ *            pendant lequel le chip-select est actif, transferts et traitements entre deux octets
+ *            compris : le bus n'est disponible pour aucun autre périphérique pendant ce temps.
+ */
+typedef struct
+{
+  uint32_t bytes;                 /**< Nombre d'octets transférés */
+  uint32_t asserted;              /**< Durée cumulée pendant laquelle le chip-select était actif */
+  uint16_t transactions;          /**< Nombre de transactions (activation du chip-select) */
+  uint16_t longest;               /**< Plus longue durée d'activation du chip-select */
+} SPI_STATISTICS;
+
+/**
+ * @brief       Récupère les statistiques d'un chip-select
+ *
+ * @param       [in]     device     Périphérique (NULL pour l'esclave par défaut SPI_SS_PIN)
+ * @param       [out]    stats      Statistiques du périphérique (à zéro si le périphérique
+ *                                  n'a jamais été sélectionné)
+ *
+ * Exemple :
+ * @code
+ * // Timer 1 libre, préscaler de 64 : les durées sont en unités de 64 cycles CPU
+ * TCCR1B = _BV(CS11) | _BV(CS10);
+ * ...
+ * SPI_STATISTICS stats;
+ * SPI_GetStats(&radio, &stats);
+ * @endcode
+ */
+void SPI_GetStats(const SPI_DEVICE * device, SPI_STATISTICS * stats);
+
+/**
+ * @brief       Remet à zéro les statistiques de tous les chip-select
+ */
+void SPI_ResetStats(void);
+
+#endif
+
 /**
  * @brief       Initialise l'interface SPI
  *
@@ -146,23 +307,61 @@ void SPI_Initialize(void);
  */
 uint8_t SPI_SendByte(uint8_t byte);
 
+/**
+ * @brief       Transmet un buffer sur la liaison SPI
+ * @details     Les octets sont enchaînés sans attente entre deux transferts : l'octet
+ *              suivant est préparé pendant la transmission de l'octet courant.
+ *              Les octets reçus sont ignorés.
+ *
+ * @param       [in]     buffer     Octets à transmettre
+ * @param       [in]     length     Nombre d'octets à transmettre
+ */
+void SPI_SendBuffer(const uint8_t * buffer, uint16_t length);
+
+/**
+ * @brief       Reçoit un buffer depuis la liaison SPI
+ * @details     Transmet des octets 0xFF et stocke les octets reçus. Les transferts sont
+ *              enchaînés sans attente entre deux octets.
+ *
+ * @param       [out]    buffer     Buffer où stocker les octets reçus
+ * @param       [in]     length     Nombre d'octets à recevoir
+ */
+void SPI_ReceiveBuffer(uint8_t * buffer, uint16_t length);
+
+/**
+ * @brief       Sélectionne un périphérique SPI
+ * @details     Applique la configuration du périphérique (mode et diviseur d'horloge)
+ *              puis active sa broche chip-select.
+ *
+ * @param       [in]     device     Périphérique à sélectionner
+ *
+ * @note        Un seul périphérique doit être sélectionné à la fois.
+ */
+void SPI_SelectDevice(const SPI_DEVICE * device);
+
+/**
+ * @brief       Désélectionne un périphérique SPI
+ *
+ * @param       [in]     device     Périphérique à désélectionner
+ */
+void SPI_DeselectDevice(const SPI_DEVICE * device);
+
 /**
  * @brief       Active l'esclave SPI
  *
  * @note        Cette macro doit être utilisée avant l'envoie des données à l'esclave
  *
- * @todo        Améliorer pour pouvoir disposer de plusieurs esclaves
+ * @note        La configuration SPI_MODE / SPI_CLOCK est réappliquée, un autre
+ *              périphérique ayant pu modifier la configuration du bus.
  */
-#define SPI_EnableSlave()       (SPI_PORT &= ~_BV(SPI_SS_PIN))  // SS to low
+#define SPI_EnableSlave()       SPI_SelectDefault()
 
 /**
  * @brief       Désactive l'esclave SPI
  *
  * @note        Cette macro doit être utilisée une fois toutes les données transmise à l'esclave
- *
- * @todo        Améliorer pour pouvoir disposer de plusieurs esclaves
  */
-#define SPI_DisableSlave()      (SPI_PORT |=  _BV(SPI_SS_PIN))  // SS to high
+#define SPI_DisableSlave()      SPI_DeselectDefault()
 
 #include <SPI_master_core.h>
 
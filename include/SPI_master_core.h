@@ -15,6 +15,118 @@
 #ifndef _SPI_MASTER_CORE_H_
 #define _SPI_MASTER_CORE_H_
 
+#if defined(SPI_STATS)
+
+#include <stddef.h>
+#include <util/atomic.h>
+
+/**
+ * @brief     Entrée de la table des statistiques
+ */
+typedef struct
+{
+  const SPI_DEVICE * device;      /**< Périphérique associé (NULL pour l'esclave par défaut) */
+  uint8_t            used;        /**< Indique si l'entrée est attribuée */
+  SPI_STATISTICS     stats;       /**< Statistiques du périphérique */
+} SPI_STATS_ENTRY;
+
+static SPI_STATS_ENTRY SPI_stats[SPI_STATS_DEVICES];
+
+// Statistiques du chip-select actif (NULL si aucun ou si la table est pleine)
+static SPI_STATISTICS * SPI_stats_current = NULL;
+
+// Valeur du timer lors de l'activation du chip-select
+static uint16_t SPI_stats_start;
+
+static SPI_STATS_ENTRY * SPI_StatsFind(const SPI_DEVICE * device)
+{
+  for (uint8_t i = 0; i < SPI_STATS_DEVICES; i++)
+  {
+    if (SPI_stats[i].used && SPI_stats[i].device == device)
+    {
+      return &SPI_stats[i];
+    }
+  }
+
+  return NULL;
+}
+
+static void SPI_StatsBegin(const SPI_DEVICE * device)
+{
+  SPI_STATS_ENTRY * entry = SPI_StatsFind(device);
+
+  if (entry == NULL)
+  {
+    // Attribution d'une entrée libre au chip-select
+    for (uint8_t i = 0; i < SPI_STATS_DEVICES; i++)
+    {
+      if (!SPI_stats[i].used)
+      {
+        entry = &SPI_stats[i];
+        entry->device = device;
+        entry->used   = 1;
+        break;
+      }
+    }
+  }
+
+  SPI_stats_current = (entry != NULL) ? &entry->stats : NULL;
+  SPI_stats_start   = SPI_STATS_TIMER;
+}
+
+static void SPI_StatsEnd(void)
+{
+  uint16_t window = SPI_STATS_TIMER - SPI_stats_start;
+
+  if (SPI_stats_current != NULL)
+  {
+    SPI_stats_current->transactions++;
+    SPI_stats_current->asserted += window;
+    if (window > SPI_stats_current->longest)
+    {
+      SPI_stats_current->longest = window;
+    }
+    SPI_stats_current = NULL;
+  }
+}
+
+void SPI_GetStats(const SPI_DEVICE * device, SPI_STATISTICS * stats)
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    SPI_STATS_ENTRY * entry = SPI_StatsFind(device);
+
+    if (entry != NULL)
+    {
+      *stats = entry->stats;
+    }
+    else
+    {
+      *stats = (SPI_STATISTICS){ 0 };
+    }
+  }
+}
+
+void SPI_ResetStats(void)
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    for (uint8_t i = 0; i < SPI_STATS_DEVICES; i++)
+    {
+      SPI_stats[i].stats = (SPI_STATISTICS){ 0 };
+    }
+  }
+}
+
+#  define SPI_STATS_BEGIN(device)   SPI_StatsBegin(device)
+#  define SPI_STATS_END()           SPI_StatsEnd()
+#  define SPI_STATS_BYTES(count)    do { if (SPI_stats_current != NULL) SPI_stats_current->bytes += (count); } while (0)
+#else
+#  define SPI_STATS_BEGIN(device)
+#  define SPI_STATS_END()
+#  define SPI_STATS_BYTES(count)
+#endif
+
 void SPI_Initialize(void)
 {
   // Default mode for software ISP :
@@ -35,24 +147,60 @@ void SPI_Initialize(void)
   SPI_PORT |=  _BV(SPI_MOSI_PIN); // SDI to high
   SPI_PORT &= ~_BV(SPI_SCK_PIN);  // SCK to low
 #else
-  /**
-   * @todo revoir le paramétrage pour les options du mode hardware
-   */
   SPCR = //_BV(SPIE)  |   // Interupt Enable
          _BV(SPE)   |   // Enable SPI
          //_BV(DORD)  |   // LSB first
          _BV(MSTR)  |   // Master
-         //_BV(CPOL)  |   // Clock Polarity (0 => Leading edge Raising + Railling Edge Falling)
-         //               //                (1 => Leading edge Falling + Railling Edge Raising)
-         //_BV(CPHA)  |   // Clock phase (0 => Leading edge Sample + Trailing Edge Setup)
-         //               //             (1 => Leading edge Setup + Trailing Edge Sample)
-         _BV(SPR0);     // fck/16
-  SPSR &= ~_BV(SPI2X);  // Pas de double vitesse
+         SPI_MODE   |   // Clock Polarity (CPOL) + Clock phase (CPHA)
+         (SPI_CLOCK & 0x03);      // SPR1 + SPR0
+  SPSR = (SPI_CLOCK & 0x04) ? _BV(SPI2X) : 0;
+#endif
+}
+
+/**
+ * @brief       Sélectionne l'esclave par défaut (SPI_SS_PIN)
+ * @details     Réapplique la configuration SPI_MODE / SPI_CLOCK puis active SPI_SS_PIN
+ */
+static inline void SPI_SelectDefault(void)
+{
+#ifndef SPI_SOFTWARE
+  SPCR = _BV(SPE) | _BV(MSTR) | SPI_MODE | (SPI_CLOCK & 0x03);
+  SPSR = (SPI_CLOCK & 0x04) ? _BV(SPI2X) : 0;
+#endif
+  SPI_PORT &= ~_BV(SPI_SS_PIN);   // SS to low
+  SPI_STATS_BEGIN(NULL);
+}
+
+/**
+ * @brief       Désélectionne l'esclave par défaut (SPI_SS_PIN)
+ */
+static inline void SPI_DeselectDefault(void)
+{
+  SPI_STATS_END();
+  SPI_PORT |=  _BV(SPI_SS_PIN);   // SS to high
+}
+
+void SPI_SelectDevice(const SPI_DEVICE * device)
+{
+#ifndef SPI_SOFTWARE
+  // Le mode et l'horloge doivent être en place avant l'activation du chip-select
+  SPCR = device->spcr;
+  SPSR = device->spsr;
 #endif
+  *device->port &= ~device->mask;  // CS to low
+  SPI_STATS_BEGIN(device);
+}
+
+void SPI_DeselectDevice(const SPI_DEVICE * device)
+{
+  SPI_STATS_END();
+  *device->port |=  device->mask;  // CS to high
 }
 
 uint8_t SPI_SendByte(uint8_t byte)
 {
+  SPI_STATS_BYTES(1);
+
 #ifdef SPI_SOFTWARE
   uint8_t recv = 0x00;
 
@@ -84,4 +232,62 @@ uint8_t SPI_SendByte(uint8_t byte)
 #endif
 }
 
+void SPI_SendBuffer(const uint8_t * buffer, uint16_t length)
+{
+  if (length == 0)
+  {
+    return;
+  }
+
+#ifdef SPI_SOFTWARE
+  while (length--)
+  {
+    SPI_SendByte(*buffer++);
+  }
+#else
+  SPI_STATS_BYTES(length);
+
+  SPDR = *buffer++;
+  while (--length)
+  {
+    // L'octet suivant est chargé pendant la transmission
+    uint8_t next = *buffer++;
+    while(!(SPSR & _BV(SPIF)));
+    SPDR = next;
+  }
+  while(!(SPSR & _BV(SPIF)));
+  // Lecture de SPDR pour acquitter SPIF
+  (void)SPDR;
+#endif
+}
+
+void SPI_ReceiveBuffer(uint8_t * buffer, uint16_t length)
+{
+  if (length == 0)
+  {
+    return;
+  }
+
+#ifdef SPI_SOFTWARE
+  while (length--)
+  {
+    *buffer++ = SPI_SendByte(0xFF);
+  }
+#else
+  SPI_STATS_BYTES(length);
+
+  SPDR = 0xFF;
+  while (--length)
+  {
+    while(!(SPSR & _BV(SPIF)));
+    // Relance immédiate du transfert suivant avant le stockage de l'octet reçu
+    uint8_t value = SPDR;
+    SPDR = 0xFF;
+    *buffer++ = value;
+  }
+  while(!(SPSR & _BV(SPIF)));
+  *buffer = SPDR;
+#endif
+}
+
 #endif /* _SPI_MASTER_CORE_H_ */